@@ -0,0 +1,147 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Types of game events stored in the binary event log.
+ *
+ * @details
+ * Values are part of the file format and must never be reordered; new types are appended.
+ */
+enum class GameEventType : uint8_t {
+    PLAYER_SPAWNED = 0,     ///< Player placed at (row, col).
+    MINOTAUR_SPAWNED = 1,   ///< Minotaur placed at (row, col).
+    ITEM_SPAWNED = 2,       ///< Item `itemId` of kind `arg` placed at (row, col).
+    PLAYER_MOVED = 3,       ///< Player moved to (row, col) with the key stored in `arg`.
+    MINOTAUR_MOVED = 4,     ///< Minotaur moved to (row, col).
+    ITEM_ACTIVATED = 5,     ///< Player picked up item `itemId` at (row, col).
+    ITEM_EXPIRED = 6,       ///< Effect of item `itemId` ran out.
+    ITEM_DESTROYED = 7,     ///< Minotaur walked over item `itemId`.
+    MINOTAUR_KILLED = 8,    ///< Player killed the minotaur at (row, col).
+    ATTACK_MISSED = 9,      ///< Player attacked from (row, col) but the minotaur was out of range.
+    STATE_CHANGED = 10      ///< Game state changed to the value stored in `arg`.
+};
+
+/**
+ * @brief Fixed-size record of the binary event log.
+ *
+ * @details
+ * Records are written in host byte order (little-endian on all supported targets).
+ * Fields that do not apply to an event type are zero, except `itemId` which is
+ * `NO_ITEM` for events not related to an item.
+ */
+struct GameEvent {
+    static constexpr uint32_t NO_ITEM = 0xFFFFFFFFu;    ///< `itemId` value of non-item events.
+
+    uint8_t type;       ///< GameEventType of the record.
+    uint8_t arg;        ///< Type-specific argument (item kind, key, game state).
+    uint16_t reserved;  ///< Always zero, keeps the following fields aligned.
+    uint32_t tick;      ///< Game loop iteration the event happened in.
+    int32_t row;        ///< Row of the event position.
+    int32_t col;        ///< Column of the event position.
+    uint32_t itemId;    ///< Index of the item in spawn order, or NO_ITEM.
+};
+
+static_assert(sizeof(GameEvent) == 20, "GameEvent is part of the file format");
+
+/**
+ * @brief Header written once at the beginning of an event log file.
+ */
+struct EventLogHeader {
+    char magic[4];          ///< Always "LBEV".
+    uint16_t version;       ///< Format version, currently 1.
+    uint16_t recordSize;    ///< sizeof(GameEvent) of the writer.
+};
+
+static_assert(sizeof(EventLogHeader) == 8, "EventLogHeader is part of the file format");
+
+/**
+ * @brief The EventLog class writes game events as a compact binary stream.
+ *
+ * @details
+ * Each event is a fixed-size GameEvent record, so recording an event is a copy into an
+ * in-memory buffer without any string formatting or allocation. The buffer is written to the
+ * file with a single write when it fills up and when the log is destroyed.
+ * The `labyrinth-logdump` tool turns the file back into readable text or CSV.
+ *
+ * Created: 18.10.2026
+ */
+class EventLog {
+    private:
+        static constexpr std::size_t BUFFER_RECORDS = 1024;    ///< Records buffered before a write.
+
+        std::ofstream file;                 ///< Binary output stream.
+        std::vector<GameEvent> buffer;      ///< Records not yet written to the file.
+
+    public:
+        static constexpr uint16_t VERSION = 1;  ///< Current file format version.
+
+        /**
+         * @brief Creates the event log file and writes its header.
+         *
+         * @param filename Path of the file to create. An empty name disables the log.
+         */
+        EventLog(const std::string& filename);
+
+        /**
+         * @brief Writes the buffered records and closes the file.
+         */
+        ~EventLog();
+
+        EventLog(const EventLog&) = delete;
+        EventLog& operator=(const EventLog&) = delete;
+
+        /**
+         * @brief Appends an event to the log.
+         *
+         * @param type Type of the event.
+         * @param tick Game loop iteration the event happened in.
+         * @param row Row of the event position.
+         * @param col Column of the event position.
+         * @param itemId Item the event refers to, or GameEvent::NO_ITEM.
+         * @param arg Type-specific argument.
+         */
+        void record(GameEventType type, uint32_t tick, int row, int col,
+                    uint32_t itemId = GameEvent::NO_ITEM, uint8_t arg = 0)
+        {
+            if (!file.is_open()) return;
+            buffer.push_back(GameEvent{ static_cast<uint8_t>(type), arg, 0, tick, row, col, itemId });
+            if (buffer.size() == BUFFER_RECORDS) {
+                flush();
+            }
+        }
+
+        /**
+         * @brief Writes all buffered records to the file.
+         */
+        void flush();
+
+        /**
+         * @brief Checks whether the log file is open.
+         *
+         * @return true If events are being recorded.
+         */
+        bool isOpen() const { return file.is_open(); }
+
+        /**
+         * @brief Retrieves the symbolic name of an event type.
+         *
+         * @param type Raw event type value.
+         * @return const char* Name such as "PLAYER_MOVED", or "UNKNOWN".
+         */
+        static const char* typeName(uint8_t type);
+
+        /**
+         * @brief Reads and validates the header of an event log stream.
+         *
+         * @param in Stream positioned at the beginning of the file.
+         * @return true If the header is valid and the records can be read as GameEvent.
+         */
+        static bool readHeader(std::istream& in);
+};
+
+#endif // EVENTLOG_H
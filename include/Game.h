@@ -4,9 +4,86 @@
 #include "Labyrinth.h"
 #include "Player.h"
 #include "Minotaur.h"
+#include "MinotaurHerd.h"
+#include "Replay.h"
 #include "Logger.h"
+#include "EventLog.h"
+#include "GameView.h"
+#include "SimClock.h"
+#include "SplitMix64.h"
+#include "Telemetry.h"
+#include "TimerWheel.h"
 #include "items/Item.h"
+#include "items/ItemPool.h"
 #include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+class DistanceField;
+
+/**
+ * @brief Action of the player for one game tick.
+ * 
+ * @details 
+ * The interactive loop maps keys to actions ('w', 's', 'a', 'd', space, 'q');
+ * bots and the headless simulation produce them directly.
+ */
+enum class PlayerAction : uint8_t {
+    NONE,       ///< Do nothing this tick.
+    UP,         ///< Move one cell up ('w').
+    DOWN,       ///< Move one cell down ('s').
+    LEFT,       ///< Move one cell left ('a').
+    RIGHT,      ///< Move one cell right ('d').
+    ATTACK,     ///< Attack the minotaur with the sword (space).
+    QUIT        ///< Give up the game ('q').
+};
+
+/**
+ * @brief Parameters of a headless game created with Game(const GameConfig&).
+ * 
+ * @details 
+ * The defaults describe a silent game without any files, suitable for running
+ * many games in parallel.
+ */
+struct GameConfig {
+    unsigned int width = 21;                ///< Width of the labyrinth.
+    unsigned int height = 21;               ///< Height of the labyrinth.
+    unsigned int numItems = 4;              ///< Number of items to spawn.
+    unsigned int seed = 0;                  ///< Seed of the labyrinth and of the game; 0 picks a random one.
+    unsigned int minotaurTicks = 20;        ///< Ticks between two minotaur moves in step() (20 ticks = 1 s of real-time play).
+    bool reachableItemsOnly = false;        ///< Spawn items only on cells the player can walk to from the start.
+    unsigned int minotaurCount = 1;         ///< Minotaurs spawned on the path from the entrance to the exit.
+    bool chasingMinotaurs = false;          ///< Minotaurs step towards the player instead of moving randomly.
+    bool quiet = true;                      ///< Suppress console output.
+    std::string logFile;                    ///< Text log file; empty disables the log.
+    std::string eventLogFile;               ///< Binary event log file; empty disables the log.
+    std::string replayFile;                 ///< Replay file of the actions played; empty disables it.
+};
+
+/**
+ * @brief Files an interactive game records into.
+ * 
+ * @details 
+ * Recording is opt-in: the defaults write neither file, so games created by tests
+ * and tools leave nothing behind. The interactive binary names both files.
+ */
+struct GameRecording {
+    std::string eventLogFile;               ///< Binary event log file; empty disables the log.
+    std::string replayFile;                 ///< Replay file of the actions played; empty disables it.
+};
+
+/**
+ * @brief Counters collected while a game runs.
+ */
+struct GameStats {
+    uint32_t ticks = 0;                     ///< Game ticks played.
+    uint32_t turns = 0;                     ///< Player moves that changed the player's cell.
+    uint32_t minotaurKills = 0;             ///< Minotaurs killed with the sword.
+    uint32_t itemsDestroyed = 0;            ///< Items the minotaur walked over before the player.
+    uint32_t pickups[4] = {0, 0, 0, 0};     ///< Items picked up, indexed by ItemKind.
+};
 
 /**
  * @brief The Game class manages the overall game state, including the labyrinth, player, minotaur, and items.
@@ -22,18 +99,76 @@
  */
 class Game
 {
+    friend class BenchAccess;       ///< Lets labyrinth-bench time spawn() on its own.
+
 private:
     
-    Labyrinth* labyrinth;           ///< Pointer to the labyrinth representing the game map.
+    std::shared_ptr<const Labyrinth> labyrinth;     ///< Labyrinth representing the game map, possibly shared with other games.
     Player* player;                 ///< Pointer to the player entity.
-    Minotaur* minotaur;             ///< Pointer to the minotaur entity.
-    std::list<Item*> items;         ///< List of pointers to items present in the labyrinth.
+    Minotaur* minotaur;             ///< Handle to the first minotaur of `minotaurs`.
+    MinotaurHerd minotaurs;         ///< Positions and alive flags of all minotaurs.
+    ItemPool items;                 ///< All items spawned in the labyrinth, in one block; addressed by item id and indexed by cell.
     int numItems;                   ///< Number of items to spawn in the labyrinth.
     uint64_t game_init_time = 0;  ///< Time taken to initialize the game in milliseconds.
 
     // Logger object to log game events
     Logger logger;
 
+    // Binary log of per-step game events (movement, items, combat),
+    // filtered by the same levels as `logger` (movement is TRACE)
+    EventLog events;
+
+    // Seeds, dimensions and the action of every tick the player acted in (game.replay for
+    // interactive games), enough to play the whole game again with playReplay()
+    ReplayWriter replay;
+    uint32_t tick = 0;              ///< Number of game loop iterations since the game started.
+
+    // Per-phase timings of the game loop, written to telemetry.log when the game ends;
+    // allocated when the interactive loop starts, so headless games stay small
+    std::unique_ptr<FrameTelemetry> telemetry;
+
+    // Ticks are the only time the game knows; the clock only decides when the interactive
+    // loop runs the next one, so pacing never changes what happens in a game
+    SimClock simClock;              ///< Paces the ticks of updateGameState() at real time.
+
+    // All randomness of the game (spawning, minotaur moves) comes from this generator,
+    // so games with the same seed and the same actions play out identically
+    unsigned int seed = std::random_device{}();     ///< Seed of the game and of its generated labyrinth.
+    SplitMix64 rng{seed};                           ///< Random generator of this game, the one GameBatch uses per game.
+
+    GameStats stats;                ///< Counters reported by getStats().
+    unsigned int minotaurTicks = 20; ///< Ticks between minotaur moves.
+    bool reachableItemsOnly = false; ///< Spawn items only on cells reachable from the player's start.
+    unsigned int minotaurCount = 1; ///< Minotaurs spawned by spawn().
+    bool chasingMinotaurs = false;  ///< Minotaurs follow `chaseField` instead of moving randomly.
+
+    // Chasing minotaurs all read one distance-to-player field, recomputed at most once per
+    // minotaur move and only when the player moved or broke a wall since the last one
+    std::unique_ptr<DistanceField> chaseField;          ///< Distances to the player; allocated for chasing minotaurs only.
+    uint32_t chaseFieldSource = UINT32_MAX;             ///< Player cell `chaseField` was computed for.
+    std::size_t chaseFieldWalls = 0;                    ///< Broken walls when `chaseField` was computed.
+
+    // Everything that happens after a delay is a timer: item effects and the shield's immunity
+    // run out after a number of player turns, the minotaur moves on the game clock. Only the
+    // timers that are due cost anything when a turn or a tick passes.
+    enum GameTimer : uint8_t {
+        TIMER_ITEM_EXPIRY,          ///< The effect of an active item runs out; the id is the item id.
+        TIMER_EFFECTS_EXPIRY,       ///< Player effects whose end turn has come are deactivated.
+        TIMER_MINOTAUR_MOVE         ///< The minotaurs move and schedule their next move.
+    };
+    TimerWheel turnTimers;          ///< Timers keyed on player turns (stats.turns).
+    TimerWheel clockTimers;         ///< Timers keyed on game ticks.
+    uint64_t clockTime = 0;         ///< Tick `clockTimers` is being advanced to.
+
+    // The labyrinth only holds the terrain and is never written by the game. Entities are
+    // tracked by their positions and walls broken with the hummer are kept here; both are
+    // drawn on top of the terrain only when a frame is rendered.
+    std::vector<uint32_t> brokenWalls;  ///< Cells (row * width + col) of walls broken with the hummer.
+    std::string frame;                  ///< Terrain with the entities on top, rebuilt for every render.
+    bool exitOnFailure = true;      ///< Exit the program instead of returning when the game cannot be set up.
+    bool ready = false;             ///< True once the labyrinth is valid and all entities are spawned.
+
+public:
     // Enumeration to represent the game state
     enum GAME_STATE {
         PLAYING,     ///< The game is currently in progress.
@@ -42,6 +177,7 @@ private:
         QUIT         ///< The player has chosen to quit the game.
     };
 
+private:
     GAME_STATE state;               ///< Current state of the game.
 
     // Game initialization methods
@@ -59,24 +195,75 @@ private:
      */
     void init(unsigned int width, unsigned int height, bool quiet, bool exitOnFailure = true);
 
+    /**
+     * @brief Initializes the game components around an existing labyrinth.
+     * 
+     * @param labyrinth A generated or loaded labyrinth; the game keeps a reference and only reads it.
+     * @param quiet Whether to suppress console output.
+     * @param exitOnFailure Whether to exit the program if the labyrinth is not valid.
+     */
+    void init(std::shared_ptr<const Labyrinth> labyrinth, bool quiet, bool exitOnFailure);
+
+    /**
+     * @brief Common part of the headless constructors: applies the configuration and spawns the entities.
+     * 
+     * @param labyrinth The labyrinth to play on; a null handle leaves the game not ready.
+     * @param config Configuration of the game.
+     */
+    void initHeadless(std::shared_ptr<const Labyrinth> labyrinth, const GameConfig& config);
+
+    /**
+     * @brief Starts recording the game into a replay file.
+     * 
+     * @param filename Path of the replay; an empty name records nothing.
+     * @param labyrinthFile File the labyrinth was loaded from, empty if it was generated.
+     */
+    void startReplay(const std::string& filename, const std::string& labyrinthFile);
+
     /**
      * @brief Spawns the player, minotaur, and randomly places items in the labyrinth.
      * 
+     * @return true If all entities were placed; false if the path is too short for the minotaur
+     *         (the program exits instead when `exitOnFailure` is set).
+     * 
      * @details 
-     * Positions the player at the start point, places the minotaur along the generated path, and randomly distributes items ensuring they are placed on empty cells.
+     * Positions the player at the start point, places the minotaur along the generated path, and places the items on distinct empty cells drawn without replacement; if there are fewer free cells than items, only as many items as cells are spawned.
+     */
+    bool spawn();
+
+    /**
+     * @brief Applies one player action: a move, an attack or quitting.
+     * 
+     * @param action The action to apply; PlayerAction::NONE does nothing.
      */
-    void spawn();
+    void handleAction(PlayerAction action);
+
+    /**
+     * @brief Maps a key of the interactive game to an action.
+     * 
+     * @param key The pressed key.
+     * @return PlayerAction The matching action, PlayerAction::NONE for other keys.
+     */
+    static PlayerAction actionFromKey(char key);
 
     // Helper methods
 
     /**
-     * @brief Determines if a specific cell is a wall or the entrance.
+     * @brief Determines if a wall cell was broken with the hummer.
      * 
      * @param position The cell position to check.
-     * @return true If the cell is a wall ('#') or the entrance ('U').
-     * @return false Otherwise.
+     * @return true If the player broke the wall at this position.
      */
-    bool isWall(const Cell& position) const;
+    bool isBrokenWall(const Cell& position) const;
+
+    /**
+     * @brief Retrieves the directions in which the player or the minotaur may step from a cell.
+     * 
+     * @param position The cell position.
+     * @return uint8_t Bit d set if the neighbour in Labyrinth::Direction d is neither a wall
+     *         (unless broken with the hummer) nor the entrance.
+     */
+    uint8_t openDirections(const Cell& position) const;
 
     /**
      * @brief Determines if a specific cell is on the border of the labyrinth.
@@ -87,15 +274,30 @@ private:
      */
     bool isMapBorder(const Cell& position) const;
 
+    /**
+     * @brief Converts a position to its row-major cell index, the key of the item index.
+     */
+    uint32_t cellIndex(const Cell& position) const;
+
+    /**
+     * @brief Finds the item lying at a position.
+     * 
+     * @param position The cell position to check.
+     * @return int The item id, or -1 if no item lies there.
+     */
+    int itemAt(const Cell& position) const;
+
     // Game logic methods
 
     /**
      * @brief Checks and handles collisions between the player, minotaur, and items.
      * 
      * @details 
-     * - If the player collides with the minotaur and is not immune, the game state is updated to PLAYER_LOST.
+     * - If the player stands on a living minotaur and is not immune, the game state is updated to PLAYER_LOST;
+     *   the herd answers this by a scan of its few minotaurs, or one table lookup for a large herd.
      * - If the player reaches the exit, the game state is updated to PLAYER_WON.
      * - Handles interactions with items, activating or deactivating them based on collisions.
+     *   Only the items lying at the player's and the minotaurs' cells are looked up.
      */
     void checkGameObjectCollision();
 
@@ -112,36 +314,69 @@ private:
     void playerMovementUpdate(char command);
 
     /**
-     * @brief Moves the minotaur randomly within the labyrinth, avoiding walls and the exit.
+     * @brief Moves every living minotaur one cell, avoiding walls and the exit.
      * 
      * @details 
-     * Attempts to move the minotaur in a random direction up to a maximum number of attempts.
-     * Ensures the minotaur does not move into walls or the exit point.
-     * Logs the minotaur's new position after a successful move.
+     * A random minotaur picks one of the open directions of its cell, other than the one onto
+     * the exit, with a single random number. A chasing minotaur steps to the neighbour closest
+     * to the player in `chaseField`, and moves randomly if none is closer. Logs the minotaurs'
+     * new positions.
      */
     void minotaurMovementUpdate();
 
     /**
-     * @brief Updates the duration of active item effects and removes them if expired.
+     * @brief Recomputes `chaseField` if the player moved or broke a wall since the last computation.
+     * 
+     * @details One breadth-first search from the player serves all chasing minotaurs.
+     */
+    void updateChaseField();
+
+    /**
+     * @brief Counts a player move and fires the turn timers that are due.
      * 
      * @details 
-     * Iterates through all items, decrementing their effect durations. If an item's effect duration reaches zero,
-     * the effect is removed from the player, and the item is deactivated and marked as used.
+     * Expired item effects are removed from the player, and the immunity granted by the
+     * shield ends; turns without due timers cost nothing beyond the counter.
+     */
+    void advanceTurn();
+
+    /**
+     * @brief Moves the game clock to `time` and fires the clock timers that are due.
+     * 
+     * @param time The tick to advance to.
+     * @return std::size_t Number of timers that fired.
      */
-    void itemsEffectUpdate();
+    std::size_t advanceClock(uint64_t time);
+
+    /**
+     * @brief Performs the action of a timer of `turnTimers` or `clockTimers`.
+     * 
+     * @param timer The timer that fired.
+     */
+    void fireTimer(const TimerWheel::Timer& timer);
 
     /**
      * @brief Allows the player to attack and kill the minotaur if it is within attack range.
      * 
      * @details 
-     * If the player has the Sword effect, this method checks all cells within a 1-cell radius around the player.
-     * If the minotaur is found within this range, it is killed, the Sword effect is removed, and the action is logged.
-     * If no minotaur is within range, an appropriate message is logged.
+     * If the player has the Sword effect, this method checks all cells within a 1-cell radius around the player
+     * in the minotaur herd. The first minotaur found within this range is killed, the Sword effect
+     * is removed, and the action is logged. If no minotaur is within range, an appropriate message is logged.
      */
     void attackMinotaur();
 
     // Print methods
 
+    /**
+     * @brief Draws the terrain, the broken walls and the entities into `frame`.
+     * 
+     * @details 
+     * The frame has one character per cell, row-major; its buffer is reused between renders.
+     * 
+     * @return const std::string& The composed frame.
+     */
+    const std::string& composeFrame();
+
     /**
      * @brief Renders the current state of the labyrinth to the console.
      * 
@@ -167,6 +402,11 @@ private:
      */
     void printGameWon();
 
+    /**
+     * @brief Prints the final map and the "You Won" or "Game Over" message.
+     */
+    void printResult();
+
 public:
     /**
      * @brief Constructs a Game object with specified dimensions and number of items.
@@ -175,11 +415,13 @@ public:
      * @param height The height of the labyrinth.
      * @param numItems The number of items to spawn in the labyrinth.
      * @param startGame Whether to automatically start the game loop (default: true for backward compatibility).
+     * @param recording Event log and replay files; empty paths (the default) record nothing.
      * 
      * @details 
      * Initializes the game by setting up the labyrinth, spawning entities. If startGame is true, starts the game loop.
      */
-    Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame = true);
+    Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame = true,
+         const GameRecording& recording = GameRecording());
 
     /**
      * @brief Constructs a Game object with specified dimensions, items count, game start flag, and quiet mode.
@@ -189,11 +431,13 @@ public:
      * @param numItems The number of items to spawn in the labyrinth.
      * @param startGame Whether to automatically start the game loop.
      * @param quiet Whether to enable quiet mode for the labyrinth.
+     * @param recording Event log and replay files; empty paths (the default) record nothing.
      * 
      * @details 
      * Initializes the game by setting up the labyrinth with quiet mode, spawning entities. If startGame is true, starts the game loop.
      */
-    Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet);
+    Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet,
+         const GameRecording& recording = GameRecording());
 
     /**
      * @brief Constructs a Game object for testing with non-exit behavior on map generation failure.
@@ -204,11 +448,144 @@ public:
      * @param startGame Whether to automatically start the game loop.
      * @param quiet Whether to enable quiet mode for the labyrinth.
      * @param exitOnFailure Whether to exit on map generation failure.
+     * @param recording Event log and replay files; empty paths (the default) record nothing.
      * 
      * @details 
      * Initializes the game by setting up the labyrinth with quiet mode and exit behavior control, spawning entities. If startGame is true, starts the game loop.
      */
-    Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet, bool exitOnFailure);
+    Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet, bool exitOnFailure,
+         const GameRecording& recording = GameRecording());
+
+    /**
+     * @brief Constructs a Game object on a labyrinth loaded from a file.
+     * 
+     * @param labyrinthFile Path of a labyrinth saved with Labyrinth::saveToFile().
+     * @param numItems The number of items to spawn in the labyrinth.
+     * @param startGame Whether to automatically start the game loop.
+     * @param recording Event log and replay files; empty paths (the default) record nothing.
+     * 
+     * @details 
+     * Loads the saved map instead of generating one, spawns entities and, if startGame is true, starts the game loop.
+     */
+    Game(const std::string& labyrinthFile, unsigned int numItems, bool startGame = true,
+         const GameRecording& recording = GameRecording());
+
+    /**
+     * @brief Constructs a headless game from a configuration.
+     * 
+     * @param config Dimensions, items, seed and log files of the game.
+     * 
+     * @details 
+     * Generates the labyrinth from the configured seed and spawns all entities without any
+     * terminal output or global random state, and never exits the program. The game is then
+     * advanced with step(). If the labyrinth cannot be used, isReady() returns false.
+     */
+    explicit Game(const GameConfig& config);
+
+    /**
+     * @brief Constructs a headless game on a labyrinth shared with other games.
+     * 
+     * @param labyrinth The shared labyrinth, e.g. from another game's getSharedLabyrinth(); it is only read.
+     * @param config Items, seed, minotaur speed and log files of the game; the dimensions are ignored.
+     * 
+     * @details 
+     * The labyrinth is never written by a game (entities and broken walls are kept per game),
+     * so any number of games, on any threads, can play on one labyrinth at the same time.
+     * Each game then only owns a few kilobytes of state.
+     */
+    Game(std::shared_ptr<const Labyrinth> labyrinth, const GameConfig& config);
+
+    /**
+     * @brief Constructs a headless game with the parameters of a recorded one.
+     * 
+     * @param header Header of a replay, see ReplayReader::getHeader().
+     * 
+     * @details 
+     * The labyrinth is generated again from its size and seed, or loaded again from the file
+     * it was loaded from; the game writes no logs. Play it back with playReplay().
+     */
+    explicit Game(const ReplayHeader& header);
+
+    /**
+     * @brief Plays the actions of a replay until the game ends.
+     * 
+     * @param replay Reader of the replay this game was constructed from, positioned after the header.
+     * @param speed Speed-up over real time; 0 (or less) plays as fast as possible.
+     * @param render Draw the map after every tick and the result at the end.
+     * @return true If every recorded action was played and, for a finished recording, the game
+     *         ended on the recorded tick.
+     * 
+     * @details 
+     * Ticks run through step() exactly as when the game was recorded, so the result does not
+     * depend on the speed. Actions are read from the file one at a time as they become due.
+     */
+    bool playReplay(ReplayReader& replay, double speed = 0.0, bool render = false);
+
+    /**
+     * @brief Advances a headless game by one tick.
+     * 
+     * @param action The player's action for this tick.
+     * 
+     * @details 
+     * Applies the action, moves the minotaur every `minotaurTicks` ticks and checks collisions,
+     * in the same order as the interactive loop. Does nothing once the game is over.
+     */
+    void step(PlayerAction action);
+
+    /**
+     * @brief Checks whether the game was set up and can be played.
+     * 
+     * @return true If the labyrinth is valid and the entities were spawned.
+     */
+    bool isReady() const { return ready; }
+
+    /**
+     * @brief Retrieves the current game state.
+     */
+    GAME_STATE getState() const { return state; }
+
+    /**
+     * @brief Checks whether the game is over (won, lost or quit).
+     */
+    bool isFinished() const { return state != GAME_STATE::PLAYING; }
+
+    /**
+     * @brief Retrieves the counters collected so far.
+     */
+    const GameStats& getStats() const { return stats; }
+
+    /**
+     * @brief Retrieves the seed of the game.
+     */
+    unsigned int getSeed() const { return seed; }
+
+    /**
+     * @brief Retrieves the number of ticks played.
+     */
+    uint32_t getTick() const { return tick; }
+
+    /**
+     * @brief Creates a read-only view of the game for automated players.
+     * 
+     * @return GameView View of the grid, the player, the minotaur and the items.
+     * 
+     * @details 
+     * Must only be called on a ready game; the view becomes stale after the next step().
+     */
+    GameView getView() const;
+
+    /**
+     * @brief Retrieves the symbol drawn for a cell: the terrain with the entities on top.
+     * 
+     * @param row The row index of the cell.
+     * @param col The column index of the cell.
+     * @return char 'R' for the player, 'M' for the living minotaur, 'P' for a lying item,
+     *         otherwise the terrain (' ' for a broken wall).
+     * 
+     * @details 
+     * The labyrinth itself only ever holds the terrain; this is what the rendered map shows.
+     */
+    char symbolAt(unsigned int row, unsigned int col) const;
 
     /**
      * @brief Starts the game loop if not already started.
@@ -222,12 +599,19 @@ public:
     /**
      * @brief Gets the current labyrinth instance.
      * 
-     * @return Pointer to the labyrinth object.
+     * @return Pointer to the labyrinth object; the game never modifies it.
      * 
      * @details 
      * Provides access to the labyrinth for testing purposes.
      */
-    Labyrinth* getLabyrinth() const;
+    const Labyrinth* getLabyrinth() const;
+
+    /**
+     * @brief Gets the shared handle of the labyrinth.
+     * 
+     * @return std::shared_ptr<const Labyrinth> The labyrinth, to start more games on the same map.
+     */
+    std::shared_ptr<const Labyrinth> getSharedLabyrinth() const;
 
     /**
      * @brief Gets the current player instance.
@@ -249,6 +633,13 @@ public:
      */
     Minotaur* getMinotaur() const;
 
+    /**
+     * @brief Gets all minotaurs of the game.
+     * 
+     * @return const MinotaurHerd& Positions and alive flags of every minotaur.
+     */
+    const MinotaurHerd& getMinotaurs() const;
+
     /**
      * @brief Checks if the labyrinth was successfully generated.
      * 
@@ -263,8 +654,8 @@ public:
      * @brief Destructor for the Game class.
      * 
      * @details 
-     * Deallocates all dynamically allocated memory, including the labyrinth, player, minotaur, and items,
-     * to prevent memory leaks.
+     * Deallocates the player, minotaur, and items. The labyrinth is released once the last game
+     * sharing it is destroyed.
      */
     ~Game();
 
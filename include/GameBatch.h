@@ -0,0 +1,214 @@
+#ifndef GAME_BATCH_H
+#define GAME_BATCH_H
+
+#include "Game.h"
+#include "Labyrinth.h"
+#include "Observation.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Many headless games on one shared labyrinth, advanced in lockstep.
+ *
+ * @details
+ * Every game of the batch plays on the same immutable labyrinth with its own player,
+ * minotaur, items and random generator. Instead of one Game object per game, the state
+ * of all games is kept in structure-of-arrays form: one array per field, indexed by game,
+ * and one plane per item slot (and per effect), indexed by slot * size() + game. Each
+ * phase of step() is a branch-free loop over games that computes targets, open bits and
+ * flags as selects, and item slots are visited one plane at a time, so the compiler can
+ * vectorize the phases. Only the lookups of the open directions of a cell are gathers.
+ *
+ * The rules are those of Game::step(): the player's action (moves, the hummer breaking a
+ * wall, the sword attack, quitting), the expiry of effects after each move, the minotaur's
+ * random move every `minotaurTicks` ticks and the collision checks. Effects, the shield's
+ * immunity included, are a mask per game with the turn each effect ends, as in Player:
+ * picking up an effect that is already active keeps the later of both ends. Entities are
+ * tracked by position rather than by characters in the grid, so the labyrinth is never
+ * written; walls broken with the hammer are kept in a small per-game overlay.
+ *
+ * Game i draws from the same SplitMix64 sequence, spawns the same way and follows the same
+ * rules as a Game with one minotaur on the same labyrinth seeded with gameSeed(seed, i),
+ * so both play out identically for the same actions.
+ *
+ * Created: 18.10.2026
+ */
+class GameBatch
+{
+    public:
+
+        static constexpr uint8_t EFFECT_FOG_OF_WAR = 1u << static_cast<int>(ItemKind::FOG_OF_WAR);  ///< Player effect bits, one per ItemKind.
+        static constexpr uint8_t EFFECT_HUMMER = 1u << static_cast<int>(ItemKind::HUMMER);
+        static constexpr uint8_t EFFECT_SHIELD = 1u << static_cast<int>(ItemKind::SHIELD);
+        static constexpr uint8_t EFFECT_SWORD = 1u << static_cast<int>(ItemKind::SWORD);
+        static constexpr uint8_t EFFECT_IMMUNITY = Player::effectBit(Player::EFFECT_IMMUNITY);
+
+        static constexpr uint32_t ITEM_EFFECT_DURATION = 3; ///< Player moves an item effect lasts (the Item default).
+        static constexpr uint32_t SHIELD_IMMUNITY = 2;      ///< Moves of immunity after the shield absorbed an attack.
+
+        /**
+         * @brief State of one item slot.
+         */
+        enum ItemState : uint8_t {
+            ITEM_NONE,      ///< Slot not used by this game.
+            ITEM_LYING,     ///< Waiting in the labyrinth.
+            ITEM_ACTIVE,    ///< Picked up, its effect is running.
+            ITEM_SPENT      ///< Effect expired, or destroyed by the minotaur.
+        };
+
+    private:
+
+        std::shared_ptr<const Labyrinth> labyrinth;     ///< Labyrinth shared by all games.
+        uint32_t width = 0;                             ///< Width of the labyrinth.
+        uint32_t height = 0;                            ///< Height of the labyrinth.
+        uint32_t startCell = 0;                         ///< Cell index where players start.
+        uint32_t exitCell = 0;                          ///< Cell index of the exit.
+        std::vector<uint8_t> terrain;                   ///< TerrainCode of every cell, row-major.
+        std::vector<uint8_t> cellMask;                  ///< Per cell: Labyrinth::getOpenMask() without the entrance in the low
+                                                        ///< four bits, bit 4 + d set if the neighbour in Direction d is off the border.
+        std::vector<uint32_t> path;                     ///< Cell indices of the path from the entrance to the exit.
+        bool ready = false;                             ///< The labyrinth is valid and its path long enough.
+
+        std::size_t games;                              ///< Number of games in the batch.
+        unsigned int itemsPerGame;                      ///< Item slots per game.
+        unsigned int minotaurTicks;                     ///< Ticks between two minotaur moves.
+        uint32_t tick = 0;                              ///< Ticks played by the batch.
+        unsigned int brokenPlanes = 0;                  ///< Planes of brokenWalls used by at least one game.
+
+        // Per game (index: game); 32 bits wide like the cells, so no phase mixes byte and word lanes
+        std::vector<uint64_t> rngState;                 ///< SplitMix64 state of each game.
+        std::vector<uint32_t> state;                    ///< Game::GAME_STATE of each game.
+        std::vector<uint32_t> playerCell;               ///< Player position as a cell index.
+        std::vector<uint32_t> minotaurCell;             ///< Minotaur position as a cell index.
+        std::vector<uint32_t> minotaurAlive;            ///< 1 while the minotaur lives.
+        std::vector<uint32_t> effects;                  ///< EFFECT_* bits of the player.
+        std::vector<uint32_t> turns;                    ///< Player moves that changed the player's cell.
+        std::vector<uint32_t> brokenCount;              ///< Walls broken with the hummer so far.
+        std::vector<uint32_t> open;                     ///< Scratch of a phase: cellMask of the cell an entity leaves, with broken walls.
+        std::vector<uint32_t> flags;                    ///< Scratch of a phase: 1 where a wall was broken or items are checked.
+        std::vector<uint32_t> picked;                   ///< Scratch of checkCollisions(): EFFECT_* bit of the item picked up.
+
+        // Per effect (index: effect * games + game)
+        std::vector<uint32_t> effectExpiry;             ///< Turn each effect ends.
+
+        // Per item slot (index: slot * games + game)
+        std::vector<uint32_t> itemCell;                 ///< Item position as a cell index.
+        std::vector<uint32_t> itemKind;                 ///< ItemKind of the item.
+        std::vector<uint32_t> itemState;                ///< ItemState of the item.
+        std::vector<uint32_t> itemExpiry;               ///< Turn at which an active item is used up.
+        std::vector<uint32_t> brokenWalls;              ///< Walls broken with the hummer (at most one per item).
+
+        /**
+         * @brief Places the player, the minotaur and the items of one game.
+         */
+        void spawn(std::size_t game);
+
+        /**
+         * @brief Fills `open` with the directions open from each game's cell in `cells`, broken walls included.
+         */
+        void gatherOpenDirections(const std::vector<uint32_t>& cells);
+
+        // Phases of step(), each a few loops over the whole batch
+        void applyActions(const PlayerAction* actions);
+        void updateItemEffects();
+        void moveMinotaurs();
+        void checkCollisions();
+
+    public:
+
+        /**
+         * @brief Creates a batch of games on a shared labyrinth and spawns all entities.
+         *
+         * @param labyrinth Generated or loaded labyrinth; it is only read.
+         * @param games Number of games.
+         * @param seed Seed of the batch; game i uses a seed derived from `seed` and i.
+         * @param itemsPerGame Items spawned in every game.
+         * @param minotaurTicks Ticks between two minotaur moves (as in GameConfig).
+         *
+         * @details If the labyrinth is not usable (generation failed or its path is too short
+         *          for the minotaur), isReady() returns false and step() does nothing.
+         */
+        GameBatch(std::shared_ptr<const Labyrinth> labyrinth, std::size_t games, unsigned int seed,
+                  unsigned int itemsPerGame = 4, unsigned int minotaurTicks = 20);
+
+        /**
+         * @brief Seed of one game of a batch, usable as a GameConfig seed.
+         *
+         * @param seed Seed of the batch.
+         * @param game Index of the game.
+         * @return unsigned int The seed labyrinth-sim gives game `game` of a run with `seed`; never 0.
+         */
+        static unsigned int gameSeed(unsigned int seed, std::size_t game);
+
+        /**
+         * @brief Restarts every game with new spawn positions.
+         *
+         * @param seed Seed of the batch, as in the constructor.
+         */
+        void reset(unsigned int seed);
+
+        /**
+         * @brief Advances every game by one tick.
+         *
+         * @param actions One action per game; finished games ignore theirs.
+         */
+        void step(const PlayerAction* actions);
+
+        bool isReady() const { return ready; }
+        std::size_t size() const { return games; }
+        uint32_t getTick() const { return tick; }
+        unsigned int getItemsPerGame() const { return itemsPerGame; }
+        const Labyrinth& getLabyrinth() const { return *labyrinth; }
+
+        /**
+         * @brief Fills a caller-provided buffer with the window around the player of one game.
+         *
+         * @param game Index of the game.
+         * @param radius Cells seen in every direction from the player.
+         * @param out Buffer of at least observationSize(radius) bytes, laid out as by fillObservation().
+         *
+         * @details Terrain rows are copied from the shared terrain plane with one memcpy per
+         *          window row, then the game's broken walls and entities are written on top.
+         */
+        void observe(std::size_t game, int radius, uint8_t* out) const;
+
+        /**
+         * @brief Fills the windows of all games, one after the other.
+         *
+         * @param radius Cells seen in every direction from the player.
+         * @param out Buffer of at least size() * observationSize(radius) bytes.
+         */
+        void observe(int radius, uint8_t* out) const;
+
+        /**
+         * @brief Counts the games that are no longer playing.
+         */
+        std::size_t countFinished() const;
+
+        Game::GAME_STATE getState(std::size_t game) const { return static_cast<Game::GAME_STATE>(state[game]); }
+        int getPlayerRow(std::size_t game) const { return static_cast<int>(playerCell[game] / width); }
+        int getPlayerCol(std::size_t game) const { return static_cast<int>(playerCell[game] % width); }
+        int getMinotaurRow(std::size_t game) const { return static_cast<int>(minotaurCell[game] / width); }
+        int getMinotaurCol(std::size_t game) const { return static_cast<int>(minotaurCell[game] % width); }
+        bool isMinotaurAlive(std::size_t game) const { return minotaurAlive[game] != 0; }
+        uint8_t getEffects(std::size_t game) const { return static_cast<uint8_t>(effects[game]); }
+        uint32_t getEffectExpiry(std::size_t game, unsigned int effect) const { return effectExpiry[effect * games + game]; }
+
+        /**
+         * @brief Remaining moves of immunity to the minotaur, 0 if the player is not immune.
+         */
+        int getImmunity(std::size_t game) const
+        {
+            return (effects[game] & EFFECT_IMMUNITY) ? static_cast<int>(getEffectExpiry(game, Player::EFFECT_IMMUNITY) - turns[game]) : 0;
+        }
+        uint32_t getTurns(std::size_t game) const { return turns[game]; }
+
+        int getItemRow(std::size_t game, unsigned int item) const { return static_cast<int>(itemCell[item * games + game] / width); }
+        int getItemCol(std::size_t game, unsigned int item) const { return static_cast<int>(itemCell[item * games + game] % width); }
+        ItemKind getItemKind(std::size_t game, unsigned int item) const { return static_cast<ItemKind>(itemKind[item * games + game]); }
+        ItemState getItemState(std::size_t game, unsigned int item) const { return static_cast<ItemState>(itemState[item * games + game]); }
+};
+
+#endif // GAME_BATCH_H
@@ -0,0 +1,128 @@
+#ifndef GAME_VIEW_H
+#define GAME_VIEW_H
+
+#include "Labyrinth.h"
+#include "Player.h"
+#include "Minotaur.h"
+#include "MinotaurHerd.h"
+#include "items/Item.h"
+#include "items/ItemPool.h"
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Read-only view of a running game, handed to automated players.
+ *
+ * @details
+ * The view only holds pointers into the game and a few copied values, so creating
+ * one per tick costs nothing and never allocates. It exposes the terrain, the player
+ * with its effects, the minotaur and the items, but none of the methods that change them.
+ * The grid only holds the terrain; entities are found through their positions.
+ * A view is valid until the game advances or is destroyed.
+ *
+ * Created: 18.10.2026
+ */
+class GameView
+{
+    private:
+
+        const Labyrinth* labyrinth;     ///< Grid of the game.
+        const Player* player;           ///< The player with its effects.
+        const Minotaur* minotaur;       ///< The first minotaur.
+        const MinotaurHerd* minotaurs;  ///< All minotaurs.
+        const ItemPool* items;          ///< All items, including used ones.
+        const std::vector<uint32_t>* brokenWalls;   ///< Cells (row * width + col) of walls broken with the hummer.
+        Cell exit;                      ///< End point of the labyrinth.
+        int width;                      ///< Width of the grid.
+        int height;                     ///< Height of the grid.
+        uint32_t tick;                  ///< Ticks played so far.
+
+    public:
+
+        /**
+         * @brief Constructs a view of the given game objects.
+         */
+        GameView(const Labyrinth* labyrinth, const Player* player, const Minotaur* minotaur, const MinotaurHerd* minotaurs,
+                 const ItemPool* items, const std::vector<uint32_t>* brokenWalls,
+                 const Cell& exit, int width, int height, uint32_t tick)
+            : labyrinth(labyrinth), player(player), minotaur(minotaur), minotaurs(minotaurs), items(items), brokenWalls(brokenWalls),
+              exit(exit), width(width), height(height), tick(tick) {}
+
+        int getWidth() const { return width; }
+        int getHeight() const { return height; }
+        uint32_t getTick() const { return tick; }
+
+        /**
+         * @brief Retrieves the terrain of a cell ('#' wall, 'U' entrance, 'I' exit, ' ' floor or broken wall).
+         */
+        char cellAt(int row, int col) const
+        {
+            char val = labyrinth->getCell(row, col).getVal();
+            if (val == '#' && !brokenWalls->empty()) {
+                const uint32_t index = static_cast<uint32_t>(row) * static_cast<uint32_t>(width) + static_cast<uint32_t>(col);
+                if (std::find(brokenWalls->begin(), brokenWalls->end(), index) != brokenWalls->end()) {
+                    return ' ';
+                }
+            }
+            return val;
+        }
+
+        /**
+         * @brief Checks whether a position lies inside the grid.
+         */
+        bool inBounds(int row, int col) const { return row >= 0 && row < height && col >= 0 && col < width; }
+
+        /**
+         * @brief Checks whether the player can step onto a cell without breaking a wall.
+         *
+         * @return true If the cell is inside the grid and neither a wall nor the entrance.
+         */
+        bool isWalkable(int row, int col) const
+        {
+            if (!inBounds(row, col)) {
+                return false;
+            }
+            char val = cellAt(row, col);
+            return val != '#' && val != 'U';
+        }
+
+        /**
+         * @brief Retrieves the directions in which the player could step from a cell.
+         *
+         * @return uint8_t Bit d set if the neighbour in Labyrinth::Direction d is walkable (see isWalkable()).
+         *
+         * @details Starts from the labyrinth's precomputed mask, adds broken walls next to the
+         *          cell and drops the entrance, so no neighbour cell has to be looked at.
+         */
+        uint8_t openDirections(int row, int col) const
+        {
+            uint8_t open = labyrinth->getOpenMask(row, col);
+            const uint32_t index = static_cast<uint32_t>(row) * static_cast<uint32_t>(width) + static_cast<uint32_t>(col);
+            for (uint32_t wall : *brokenWalls) {
+                open |= Labyrinth::directionBit(index, wall, static_cast<uint32_t>(width));
+            }
+            const Cell entrance = labyrinth->getStartPoint();
+            const uint32_t entranceIndex = static_cast<uint32_t>(entrance.getRow()) * static_cast<uint32_t>(width) +
+                                           static_cast<uint32_t>(entrance.getCol());
+            return static_cast<uint8_t>(open & ~Labyrinth::directionBit(index, entranceIndex, static_cast<uint32_t>(width)));
+        }
+
+        const Player& getPlayer() const { return *player; }
+        const Minotaur& getMinotaur() const { return *minotaur; }
+
+        /**
+         * @brief Retrieves all minotaurs; getMinotaur() is the one with index 0.
+         */
+        const MinotaurHerd& getMinotaurs() const { return *minotaurs; }
+        const Cell& getExit() const { return exit; }
+
+        /**
+         * @brief Retrieves all items of the game; used items have already been picked up or destroyed.
+         * 
+         * @details ItemPool::lying() lists the ids of the items still in the labyrinth.
+         */
+        const ItemPool& getItems() const { return *items; }
+};
+
+#endif // GAME_VIEW_H
@@ -2,7 +2,68 @@
 #define LABYRINTH_H
 
 #include "Cell.h"
+#include <cstdint>
 #include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Header of the binary labyrinth format written by Labyrinth::saveToBinaryFile().
+ * 
+ * @details 
+ * All fields are stored in host byte order (little-endian on all supported targets).
+ * The header is followed by `payloadSize` bytes of wall plane: one bit per cell
+ * (1 = wall), each row padded to a whole byte, least significant bit first. With the
+ * `FLAG_RUN_LENGTH` flag every row is instead a sequence of LEB128 run lengths that
+ * alternate between floor and wall, starting with floor.
+ * The checksum is FNV-1a over the header (with `checksum` set to zero) and the payload.
+ */
+struct LabyrinthFileHeader {
+    static constexpr uint16_t VERSION = 1;              ///< Current format version.
+    static constexpr uint16_t FLAG_RUN_LENGTH = 1;      ///< Wall plane rows are run-length encoded.
+
+    char magic[4];          ///< Always "LBYB".
+    uint16_t version;       ///< Format version.
+    uint16_t flags;         ///< Combination of FLAG_* values.
+    uint32_t width;         ///< Number of columns.
+    uint32_t height;        ///< Number of rows.
+    uint32_t seed;          ///< Seed the labyrinth was generated with.
+    uint32_t startRow;      ///< Row of the entrance ('U').
+    uint32_t startCol;      ///< Column of the entrance ('U').
+    uint32_t endRow;        ///< Row of the exit ('I').
+    uint32_t endCol;        ///< Column of the exit ('I').
+    uint32_t pathLength;    ///< Number of cells of the shortest path from 'U' to 'I'.
+    uint32_t payloadSize;   ///< Size of the wall plane in bytes.
+    uint32_t checksum;      ///< FNV-1a checksum of header and payload.
+};
+
+static_assert(sizeof(LabyrinthFileHeader) == 48, "LabyrinthFileHeader is part of the file format");
+
+/**
+ * @brief Breakdown of the work done by Labyrinth::generate().
+ * 
+ * @details 
+ * Phase timings are summed over all attempts. Scratch memory is the largest amount of
+ * temporary memory (set arrays of the Eller pass, BFS visited grid and queue) held at
+ * any one time, not counting the grid itself.
+ */
+struct GenerationStats {
+    uint64_t resetNs = 0;                   ///< Refilling the grid with walls.
+    uint64_t ellerNs = 0;                   ///< Eller-like carving pass.
+    uint64_t semicircleNs = 0;              ///< Carving the semicircles around 'U' and 'I'.
+    uint64_t pathCheckNs = 0;               ///< isPathExists() BFS.
+    uint64_t wallConditionNs = 0;           ///< wallCondition() check.
+    uint64_t findPathNs = 0;                ///< Final findPathFromEntranceToExit() of the accepted map.
+    uint64_t totalNs = 0;                   ///< Whole generate() call.
+
+    unsigned int attempts = 0;              ///< Attempts made, including the successful one.
+    unsigned int noPathFailures = 0;        ///< Attempts rejected because 'U' and 'I' were not connected.
+    unsigned int wallConditionFailures = 0; ///< Attempts rejected because the map had too few walls.
+
+    uint64_t bfsCellsVisited = 0;           ///< Cells dequeued by isPathExists() over all attempts.
+    std::size_t peakScratchBytes = 0;       ///< Peak temporary memory in bytes (approximate).
+};
 
 /**
  * @brief The Labyrinth class represents the game map consisting of cells arranged in a grid.
@@ -18,6 +79,8 @@
  */
 class Labyrinth
 {
+    friend class BenchAccess;                 ///< Lets labyrinth-bench time the private generation phases.
+
 private:
     unsigned int width;                       ///< The width of the labyrinth.
     unsigned int height;                      ///< The height of the labyrinth.
@@ -27,13 +90,25 @@ private:
     Cell startPoint;                          ///< The starting point ('U') of the labyrinth.
     Cell endPoint;                            ///< The ending point ('I') of the labyrinth.
 
-    Cell** labyrinth;                         ///< 2D array representing the labyrinth grid.
+    Cell** labyrinth = nullptr;               ///< 2D array representing the labyrinth grid (rows of one contiguous block).
+
+    std::vector<uint8_t> openMasks;           ///< Per cell (row-major), bit d set if the neighbour in Direction d is inside the grid and not a wall.
+    std::vector<uint32_t> floorCells;         ///< Row-major indices of the empty (' ') cells, ascending.
+    std::vector<uint32_t> reachableFloorCells; ///< The empty cells reachable from the cell below the entrance, ascending.
+    bool floorIndexed = false;                ///< The floor lists describe the current grid; setCell() rebuilds them.
 
     std::list<Cell*> pathFromEntranceToExit;  ///< List of cells representing the path from entrance to exit.
     
     bool quietMode = false;                   ///< Flag to suppress debug output during tests
+
+    bool boxDrawing = false;                  ///< Draw walls with box-drawing glyphs when printing.
     
-    uint64_t generation_time = 0;                  ///< Time taken to generate the labyrinth in milliseconds
+    unsigned int seed = 0;                    ///< Seed of the random generator used to generate the labyrinth.
+    std::mt19937 rng;                         ///< Random generator of this labyrinth (no global rand() state).
+
+    uint64_t generation_time = 0;                  ///< Time taken to generate (or load) the labyrinth in milliseconds
+
+    GenerationStats generationStats;          ///< Per-phase statistics of the last generate() call.
 
     /**
      * @brief Finds a path from the entrance to the exit using BFS.
@@ -60,12 +135,14 @@ private:
      * @param sc Starting column index.
      * @param er Ending row index.
      * @param ec Ending column index.
+     * @param stats If not null, receives the visited cells and the scratch memory used by the search.
      * 
      * @return true If a path exists.
      * @return false Otherwise.
      */
     bool isPathExists(unsigned int sr, unsigned int sc,
-                      unsigned int er, unsigned int ec);
+                      unsigned int er, unsigned int ec,
+                      GenerationStats* stats = nullptr);
     
     /**
      * @brief Validates the wall condition to ensure labyrinth complexity.
@@ -79,8 +156,86 @@ private:
      */
     bool wallCondition();
 
+    /**
+     * @brief Allocates the grid as one contiguous block of `height * width` cells.
+     * 
+     * @details 
+     * Row pointers in `labyrinth` point into the block, so `labyrinth[row][col]` keeps working
+     * while construction needs a single allocation instead of one per row.
+     */
+    void allocateGrid();
+
+    /**
+     * @brief Computes the open-direction mask of every cell from the grid.
+     * 
+     * @details 
+     * Called once the grid holds a candidate map (after carving, before the path check) and
+     * after loading; setCell() keeps the masks current from then on.
+     */
+    void computeOpenMasks();
+
+    /**
+     * @brief Updates the masks of the four neighbours of a cell whose wall state may have changed.
+     */
+    void updateOpenMasks(unsigned int row, unsigned int col);
+
+    /**
+     * @brief Collects the empty cells, all of them and those reachable from the cell below the entrance.
+     * 
+     * @details 
+     * Called once the map is final, after generation and after loading. Games sharing the
+     * labyrinth spawn their items from these lists instead of each scanning the grid.
+     */
+    void indexFloorCells();
+
+    /**
+     * @brief Parses a labyrinth saved with saveToFile() from an in-memory buffer.
+     * 
+     * @param data Pointer to the file contents.
+     * @param size Size of the file contents in bytes.
+     * @return true If the buffer holds a rectangular labyrinth with one entrance and one exit.
+     * 
+     * @details 
+     * Game objects ('R', 'M', 'P') saved together with the map are turned back into floor cells.
+     */
+    bool parseText(const char* data, std::size_t size);
+
+    /**
+     * @brief Parses a labyrinth saved with saveToBinaryFile() from an in-memory buffer.
+     * 
+     * @param data Pointer to the file contents.
+     * @param size Size of the file contents in bytes.
+     * @param pathLength Receives the path length stored in the header.
+     * @return true If the header, the checksum and the wall plane are valid.
+     */
+    bool parseBinary(const unsigned char* data, std::size_t size, uint32_t& pathLength);
+
+    /**
+     * @brief Prints the grid, or a frame composed over it, optionally under the fog of war.
+     * 
+     * @param frame Row-major symbols of every cell, or nullptr to print the grid itself.
+     * @param fogCenter If not null, only the 3x3 area around it and the border are shown.
+     */
+    void printRows(const char* frame, const Cell* fogCenter) const;
+
 public:
 
+    /**
+     * @brief Directions to the four neighbours of a cell, in the order of the moves UP, DOWN, LEFT, RIGHT.
+     * 
+     * @details Bit d of an open-direction mask stands for Direction d; `d ^ 1` is the opposite direction.
+     */
+    enum Direction : uint8_t {
+        DIRECTION_UP,
+        DIRECTION_DOWN,
+        DIRECTION_LEFT,
+        DIRECTION_RIGHT,
+        DIRECTION_COUNT
+    };
+
+    static constexpr int DIRECTION_ROW[DIRECTION_COUNT] = { -1, 1, 0, 0 };  ///< Row offset of each Direction.
+    static constexpr int DIRECTION_COL[DIRECTION_COUNT] = { 0, 0, -1, 1 };  ///< Column offset of each Direction.
+
     /**
      * @brief Default constructor for the Labyrinth class.
      * 
@@ -108,6 +263,31 @@ public:
      * @param quiet Whether to suppress debug output.
      */
     Labyrinth(unsigned int w, unsigned int h, bool quiet);
+
+    /**
+     * @brief Constructs a Labyrinth object generated from a given seed.
+     * 
+     * @param w The width of the labyrinth.
+     * @param h The height of the labyrinth.
+     * @param quiet Whether to suppress debug output.
+     * @param seed Seed of the labyrinth's random generator; equal seeds give equal maps.
+     */
+    Labyrinth(unsigned int w, unsigned int h, bool quiet, unsigned int seed);
+
+    /**
+     * @brief Loads a labyrinth previously written with saveToFile().
+     * 
+     * @param filename Path of the saved labyrinth.
+     * @param quiet Whether to suppress debug output.
+     * 
+     * @details 
+     * Both the text format of saveToFile() and the binary format of saveToBinaryFile() are accepted;
+     * the format is detected from the first bytes of the file.
+     * The file is memory-mapped and its rows are parsed in place, so no generation is performed.
+     * The path from the entrance to the exit is recomputed. If the file cannot be read or is not
+     * a valid labyrinth, getMapGenerationSuccess() returns false.
+     */
+    explicit Labyrinth(const std::string& filename, bool quiet = false);
     
     /**
      * @brief Destructor for the Labyrinth class.
@@ -133,9 +313,20 @@ public:
      * @brief Prints the entire labyrinth to the console.
      * 
      * @details 
-     * Displays the labyrinth with all cells visible, including game objects.
+     * Displays the terrain with all cells visible. A running game draws its entities
+     * with print(const std::string&) instead, since they are not stored in the grid.
+     */
+    void print() const;
+
+    /**
+     * @brief Prints a frame composed over the labyrinth, such as the terrain with the game objects on top.
+     * 
+     * @param frame One symbol per cell, row-major, `getWidth() * getHeight()` characters.
+     * 
+     * @details 
+     * A frame of the wrong size is ignored and the grid itself is printed.
      */
-    void print();
+    void print(const std::string& frame) const;
 	
 	 /**
      * @brief Save the entire labyrinth to the file.
@@ -145,6 +336,21 @@ public:
      */
 	void saveToFile(const std::string& filename);
     
+    /**
+     * @brief Saves the static map to a compact binary file.
+     * 
+     * @param filename Path of the file to write.
+     * @param runLengthEncoded If true, each row of the wall plane is stored as run lengths.
+     * @return true If the file was written successfully.
+     * 
+     * @details 
+     * The file holds a versioned header (dimensions, seed, entrance and exit, path length,
+     * checksum) followed by a wall plane with one bit per cell. Game objects are not saved.
+     * A labyrinth of W x H cells takes about W * H / 8 bytes. The file is loaded with
+     * the Labyrinth(const std::string&, bool) constructor, which detects the format.
+     */
+    bool saveToBinaryFile(const std::string& filename, bool runLengthEncoded = false);
+
     /**
      * @brief Prints the labyrinth with a fog of war effect based on the player's position.
      * 
@@ -153,35 +359,43 @@ public:
      * @details 
      * Limits the visibility of the labyrinth to a 3x3 area around the player, hiding other areas.
      */
-    void printWithFogOfWar(const Cell& playerPos);
+    void printWithFogOfWar(const Cell& playerPos) const;
+
+    /**
+     * @brief Prints a frame composed over the labyrinth with the fog of war effect.
+     * 
+     * @param playerPos The current position of the player.
+     * @param frame One symbol per cell, row-major, as for print(const std::string&).
+     */
+    void printWithFogOfWar(const Cell& playerPos, const std::string& frame) const;
 
     /**
      * @brief Retrieves the end point ('I') of the labyrinth.
      * 
      * @return Cell The end point of the labyrinth.
      */
-    Cell getEndPoint();
+    Cell getEndPoint() const;
     
     /**
      * @brief Retrieves the start point ('U') of the labyrinth.
      * 
      * @return Cell The start point of the labyrinth.
      */
-    Cell getStartPoint();
+    Cell getStartPoint() const;
 
     /**
      * @brief Retrieves the width of the labyrinth.
      * 
      * @return unsigned int The width of the labyrinth.
      */
-    unsigned int getWidth();
+    unsigned int getWidth() const;
     
     /**
      * @brief Retrieves the height of the labyrinth.
      * 
      * @return unsigned int The height of the labyrinth.
      */
-    unsigned int getHeight();
+    unsigned int getHeight() const;
 
     /**
      * @brief Sets the value of a specific cell in the labyrinth.
@@ -191,7 +405,8 @@ public:
      * @param cell The Cell object to set at the specified position.
      * 
      * @details 
-     * Updates the cell at the given row and column with the provided Cell object.
+     * Updates the cell at the given row and column with the provided Cell object, along with
+     * the open masks of its neighbours and, on a finished map, the lists of floor cells.
      */
     void setCell(unsigned int row, unsigned int col, const Cell& cell);
     
@@ -201,16 +416,106 @@ public:
      * @param row The row index of the cell.
      * @param col The column index of the cell.
      * 
+     * @return const Cell& Reference to the specified cell.
+     */
+    const Cell& getCell(unsigned int row, unsigned int col) const;
+
+    /**
+     * @brief Retrieves a writable reference to a specific cell in the labyrinth.
+     * 
+     * @param row The row index of the cell.
+     * @param col The column index of the cell.
+     * 
      * @return Cell& Reference to the specified cell.
+     * 
+     * @details Unlike setCell(), writing through the reference updates neither the open
+     * masks nor the floor lists.
+     */
+    Cell& getCell(unsigned int row, unsigned int col);
+
+    /**
+     * @brief Retrieves the directions in which a cell has a walkable neighbour.
+     * 
+     * @param row The row index of the cell.
+     * @param col The column index of the cell.
+     * @return uint8_t Bit d set if the neighbour in Direction d is inside the grid and not a wall ('#').
+     * 
+     * @details 
+     * The masks are computed once per map and updated by setCell(); writing a cell through
+     * getCell() does not update them. The entrance and the exit count as open.
+     */
+    uint8_t getOpenMask(unsigned int row, unsigned int col) const
+    {
+        return openMasks[static_cast<std::size_t>(row) * width + col];
+    }
+
+    /**
+     * @brief Retrieves the empty (' ') cells of the labyrinth.
+     * 
+     * @return const std::vector<uint32_t>& Row-major cell indices in ascending order.
+     */
+    const std::vector<uint32_t>& getFloorCells() const { return floorCells; }
+
+    /**
+     * @brief Retrieves the empty cells a player starting below the entrance can walk to.
+     * 
+     * @return const std::vector<uint32_t>& Row-major cell indices in ascending order.
+     */
+    const std::vector<uint32_t>& getReachableFloorCells() const { return reachableFloorCells; }
+
+    /**
+     * @brief Retrieves the direction bit leading from one cell to an adjacent one.
+     * 
+     * @param from Row-major index of the first cell.
+     * @param to Row-major index of the second cell.
+     * @param width Width of the grid.
+     * @return uint8_t The bit of the Direction from `from` to `to`, or 0 if the cells are not adjacent.
+     */
+    static uint8_t directionBit(uint32_t from, uint32_t to, uint32_t width)
+    {
+        if (to + width == from) return 1u << DIRECTION_UP;
+        if (from + width == to) return 1u << DIRECTION_DOWN;
+        if (to + 1 == from && from % width != 0) return 1u << DIRECTION_LEFT;
+        if (from + 1 == to && to % width != 0) return 1u << DIRECTION_RIGHT;
+        return 0;
+    }
+
+    /**
+     * @brief Picks the n-th set bit of a direction mask.
+     * 
+     * @param mask Open-direction mask.
+     * @param n Index of the bit among the set ones, below the number of set bits.
+     * @return Direction The direction of that bit.
+     */
+    static Direction nthDirection(uint8_t mask, unsigned int n)
+    {
+        for (; n > 0; n--) {
+            mask &= static_cast<uint8_t>(mask - 1); // Drops the lowest set bit
+        }
+        return static_cast<Direction>(__builtin_ctz(mask));
+    }
+
+    /**
+     * @brief Retrieves the box-drawing glyph of a wall from the directions of its wall neighbours.
+     * 
+     * @param walls Bit d set if the neighbour in Direction d is a wall as well.
+     * @return const char* A UTF-8 glyph such as "┼" or "─".
+     */
+    static const char* wallGlyph(uint8_t walls);
+
+    /**
+     * @brief Chooses whether print() draws walls with box-drawing glyphs instead of '#'.
+     * 
+     * @param enabled If true, every wall is drawn with wallGlyph() of its wall neighbours.
      */
-    Cell& getCell(unsigned int row, unsigned int col) const;
+    void setBoxDrawing(bool enabled);
 
     /**
      * @brief Checks if the labyrinth map was generated successfully.
      * 
      * @return bool True if generation was successful, false otherwise.
      */
-    bool getMapGenerationSuccess();
+    bool getMapGenerationSuccess() const;
 
     /**
      * @brief Sets quiet mode to suppress debug output during tests.
@@ -226,12 +531,26 @@ public:
      */
     uint64_t getGenerationTime() const;
 
+    /**
+     * @brief Retrieves the seed the labyrinth was generated with.
+     * 
+     * @return unsigned int The random seed (stored in binary files as well).
+     */
+    unsigned int getSeed() const;
+
+    /**
+     * @brief Retrieves the per-phase statistics of the last generation.
+     * 
+     * @return const GenerationStats& Timings, attempts and failure reasons; all zero for loaded labyrinths.
+     */
+    const GenerationStats& getGenerationStats() const;
+
     /**
      * @brief Retrieves the path from the entrance to the exit.
      * 
      * @return std::list<Cell*> The list of cells forming the path.
      */
-    std::list<Cell*> getPathFromEntranceToExit();
+    std::list<Cell*> getPathFromEntranceToExit() const;
 };
 
 #endif // LABYRINTH_H
\ No newline at end of file
@@ -5,60 +5,291 @@
 #include <fstream>
 #include <string>
 #include <ctime>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Severity of a log record.
+ *
+ * @details
+ * Ordered from the most verbose to the most important one, so levels can be compared
+ * with the usual relational operators.
+ */
+enum class LogLevel : uint8_t {
+    TRACE = 0,  ///< Per-step diagnostics (movement, ticks).
+    DEBUG = 1,  ///< Detailed state changes useful while debugging.
+    INFO  = 2,  ///< Regular game lifecycle messages.
+    WARN  = 3,  ///< Unexpected situations that do not stop the game.
+    OFF   = 4   ///< Threshold only: disables all records.
+};
+
+/**
+ * @brief Compile-time minimum log level (numeric LogLevel value).
+ *
+ * @details
+ * Records below this level are removed by the compiler when logged through the
+ * LOG_* macros. Set it with -DLABYRINTH_LOG_MIN_LEVEL=<0..4> (CMake cache variable of the same name).
+ */
+#ifndef LABYRINTH_LOG_MIN_LEVEL
+#define LABYRINTH_LOG_MIN_LEVEL 0
+#endif
+
+/**
+ * @brief Evaluates to true if records of `level` are compiled in.
+ *
+ * @details With the default minimum of 0 every level is kept and no comparison is emitted,
+ *          which keeps -Wtype-limits quiet.
+ */
+#if LABYRINTH_LOG_MIN_LEVEL > 0
+#define LOG_COMPILED_IN(level) (static_cast<int>(level) >= LABYRINTH_LOG_MIN_LEVEL)
+#else
+#define LOG_COMPILED_IN(level) true
+#endif
+
+/**
+ * @brief Evaluates to true if records of `level` pass both the compile-time and the runtime threshold.
+ *
+ * @details The compile-time part is a constant expression, so disabled levels fold away entirely.
+ */
+#define LOG_ENABLED(logger, level) \
+    (LOG_COMPILED_IN(level) && (logger).isEnabled(level))
+
+/**
+ * @brief Logs a message built lazily: `message` is only evaluated if the level is enabled.
+ *
+ * @details A disabled level costs one predictable branch and never constructs the message string.
+ */
+#define LOG_AT(logger, level, message)                  \
+    do {                                                \
+        if (LOG_ENABLED(logger, level)) {               \
+            (logger).log((message), (level));           \
+        }                                               \
+    } while (0)
+
+#define LOG_TRACE(logger, message) LOG_AT(logger, LogLevel::TRACE, message)
+#define LOG_DEBUG(logger, message) LOG_AT(logger, LogLevel::DEBUG, message)
+#define LOG_INFO(logger, message)  LOG_AT(logger, LogLevel::INFO, message)
+#define LOG_WARN(logger, message)  LOG_AT(logger, LogLevel::WARN, message)
+
+/**
+ * @brief Defines when the asynchronous writer pushes buffered records to disk.
+ */
+enum class FlushPolicy : uint8_t {
+    ON_INTERVAL,    ///< Flush after every batch, at most once per flush interval.
+    ON_EXIT,        ///< Flush only when the logger is destroyed.
+    ON_LEVEL        ///< Flush as soon as a record at or above the flush level is written.
+};
+
+/**
+ * @brief Configuration of a Logger instance.
+ *
+ * @details
+ * The default options describe the classic synchronous logger, so existing callers
+ * keep their behavior. Setting `async` moves formatting and file I/O to a background thread.
+ */
+struct LoggerOptions {
+    bool async = false;                                   ///< Use the background writer thread.
+    FlushPolicy flushPolicy = FlushPolicy::ON_INTERVAL;   ///< When buffered records reach the disk.
+    std::chrono::milliseconds flushInterval{200};         ///< Writer wake-up period.
+    LogLevel flushLevel = LogLevel::WARN;                 ///< Level that triggers a flush with ON_LEVEL.
+    std::size_t ringCapacity = 1024;                      ///< Number of records in the ring (rounded up to a power of two).
+    LogLevel level = LogLevel::TRACE;                     ///< Runtime threshold: lower records are ignored.
+};
 
 /**
  * @brief The Logger class provides functionality to log messages to a file with timestamps.
- * 
- * @details 
- * This class handles the creation and management of a log file. It allows logging messages with 
+ *
+ * @details
+ * This class handles the creation and management of a log file. It allows logging messages with
  * the current timestamp, facilitating the tracking of events and actions within the game.
- * 
+ *
+ * In asynchronous mode producers copy their message into a pre-sized record of a bounded
+ * lock-free ring and return immediately. A background thread drains the ring, formats the
+ * timestamps and writes whole batches with a single stream write, so the game loop never
+ * waits for the disk. When the ring is full the record is dropped and counted instead of blocking.
+ *
  * Author: Roman Avanesov
  * Created: 25.12.2024
  * Last Modified: 30.12.2024
  */
 class Logger {
+    public:
+        static constexpr std::size_t MAX_MESSAGE_LENGTH = 240; ///< Longer async messages are truncated.
+
     private:
+        /**
+         * @brief Fixed-size record stored in the asynchronous ring.
+         */
+        struct Record {
+            std::atomic<std::size_t> sequence{0};   ///< Slot sequence number (Vyukov bounded queue).
+            std::time_t timestamp = 0;              ///< Time the record was produced.
+            LogLevel level = LogLevel::INFO;        ///< Severity of the record.
+            bool timestamped = true;                ///< False for records written with save().
+            uint16_t length = 0;                    ///< Number of used bytes in `text`.
+            char text[MAX_MESSAGE_LENGTH];          ///< Message payload (not null-terminated).
+        };
+
         std::ofstream logFile;      ///< Output file stream for the log file.
+        LoggerOptions options;      ///< Options the logger was created with.
+        bool fileOpen = false;      ///< Cached open state, safe to read from producer threads.
+        bool disabled = false;      ///< Created without a filename: records are silently discarded.
+        std::atomic<LogLevel> threshold{LogLevel::TRACE};   ///< Runtime minimum level.
+
+        // Asynchronous mode state
+        std::unique_ptr<Record[]> ring;                 ///< Ring of pre-sized records.
+        std::size_t ringMask = 0;                       ///< Capacity - 1, used to wrap positions.
+        std::atomic<std::size_t> enqueuePos{0};         ///< Next position claimed by producers.
+        std::size_t dequeuePos = 0;                     ///< Next position read by the writer thread.
+        std::atomic<uint64_t> droppedRecords{0};        ///< Records lost because the ring was full.
+        std::atomic<bool> running{false};               ///< Writer thread keeps running while true.
+        std::atomic<bool> urgentFlush{false};           ///< Set by producers to request an early flush.
+        std::atomic<bool> flushRequested{false};        ///< Set by flush() to force a stream flush.
+        std::mutex wakeMutex;                           ///< Mutex paired with both condition variables.
+        std::condition_variable wakeCondition;          ///< Wakes the writer thread early.
+        std::condition_variable flushedCondition;       ///< Signals that `flushedPos` advanced.
+        std::size_t flushedPos = 0;                     ///< Ring position known to be on disk (guarded by `wakeMutex`).
+        std::thread writer;                             ///< Background writer thread.
+        std::unique_ptr<char[]> streamBuffer;           ///< Large buffer installed into `logFile`.
+
+        std::time_t cachedSecond = -1;                  ///< Second of the last formatted timestamp.
+        char cachedTime[32] = {0};                      ///< Last formatted timestamp (writer thread only).
 
         /**
          * @brief Retrieves the current system time formatted as a string.
-         * 
+         *
          * @return std::string The current time in "YYYY-MM-DD HH:MM:SS" format.
          */
         std::string getCurrentTime();
 
+        /**
+         * @brief Copies a message into the next free ring record.
+         *
+         * @param message The message to enqueue.
+         * @param level Severity of the message.
+         * @param timestamped Whether the writer should prefix the message with a timestamp.
+         */
+        void enqueue(const std::string& message, LogLevel level, bool timestamped);
+
+        /**
+         * @brief Main loop of the background writer thread.
+         */
+        void writerLoop();
+
+        /**
+         * @brief Moves all published records from the ring into a single batch and writes it.
+         *
+         * @param batch Reusable buffer that receives the formatted records.
+         * @return true If a record at or above the flush level was written.
+         */
+        bool drain(std::string& batch);
+
+        /**
+         * @brief Formats a timestamp, reusing the previous result within the same second.
+         *
+         * @param timestamp The time to format.
+         * @return const char* Formatted "YYYY-MM-DD HH:MM:SS" string.
+         */
+        const char* formatTime(std::time_t timestamp);
+
     public:
         /**
          * @brief Constructs a Logger object and opens the specified log file.
-         * 
+         *
          * @param filename The name of the log file to create or append to.
-         * 
          * @throws std::ios_base::failure If the log file cannot be opened.
          */
         Logger(const std::string& filename);
 
+        /**
+         * @brief Constructs a Logger object with the given options.
+         *
+         * @param filename The name of the log file to create; empty disables the logger.
+         * @param options Synchronous/asynchronous mode and flush policy.
+         */
+        Logger(const std::string& filename, const LoggerOptions& options);
+
         /**
          * @brief Destructor for the Logger class.
-         * 
-         * @details Closes the log file if it is open.
+         *
+         * @details Stops the writer thread (if any), writes the remaining records and closes the log file.
          */
         ~Logger();
 
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
         /**
          * @brief Logs a message to the log file with a timestamp.
-         * 
+         *
          * @param message The message to be logged.
+         * @param level Severity of the message.
          */
-        void log(const std::string& message);
+        void log(const std::string& message, LogLevel level = LogLevel::INFO);
 
         /**
          * @brief Logs a message to the log file without a timestamp.
-         * 
+         *
          * @param message The message to be logged.
          */
         void save(const std::string& message);
 
+        /**
+         * @brief Blocks until every record enqueued so far has been written and flushed.
+         *
+         * @details Intended for shutdown paths and tests; the game loop never calls it.
+         */
+        void flush();
+
+        /**
+         * @brief Checks whether records of the given level are written.
+         *
+         * @param level Level to check.
+         * @return true If the level is at or above the runtime threshold.
+         */
+        bool isEnabled(LogLevel level) const { return level >= threshold.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Sets the runtime threshold.
+         *
+         * @param level Records below this level are ignored; LogLevel::OFF disables logging.
+         */
+        void setLevel(LogLevel level) { threshold.store(level, std::memory_order_relaxed); }
+
+        /**
+         * @brief Retrieves the runtime threshold.
+         *
+         * @return LogLevel Current minimum level.
+         */
+        LogLevel getLevel() const { return threshold.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Parses a level name ("trace", "debug", "info", "warn", "off").
+         *
+         * @param name Level name, case-insensitive.
+         * @param fallback Value returned if the name is not recognized.
+         * @return LogLevel Parsed level.
+         */
+        static LogLevel parseLevel(const std::string& name, LogLevel fallback);
+
+        /**
+         * @brief Checks whether the logger runs in asynchronous mode.
+         *
+         * @return true If a background writer thread is used.
+         */
+        bool isAsync() const { return options.async; }
+
+        /**
+         * @brief Retrieves the number of records dropped because the ring was full.
+         *
+         * @return uint64_t Number of dropped records.
+         */
+        uint64_t getDroppedRecords() const { return droppedRecords.load(std::memory_order_relaxed); }
+
 };
 
-#endif // LOGGER_H
\ No newline at end of file
+#endif // LOGGER_H
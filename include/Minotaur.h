@@ -2,13 +2,17 @@
 #define MINOTAUR_H
 
 #include "Cell.h"
+#include "MinotaurHerd.h"
+#include <cstdint>
 
 /**
  * @brief The Minotaur class represents the mythical creature navigating through the labyrinth.
  * 
  * @details 
- * Manages the Minotaur's position and alive status. Provides methods to retrieve and
- * update the Minotaur's position, check if it is alive, and to kill it.
+ * A Minotaur is a handle to one minotaur of a MinotaurHerd, which stores the positions and
+ * alive flags of all minotaurs of a game. Provides methods to retrieve and update the
+ * Minotaur's position, check if it is alive, and to kill it; a handle to an index the herd
+ * does not have reports a dead minotaur.
  * 
  * Author: Roman Avanesov
  * Created: 25.12.2024
@@ -17,17 +21,18 @@
 class Minotaur {
 
     private:
-        Cell position;      ///< The current position of the Minotaur in the labyrinth.
-        bool alive;         ///< Indicates whether the Minotaur is alive.
+        MinotaurHerd* herd;     ///< Herd holding the Minotaur's position and alive status.
+        uint32_t index;         ///< Index of the Minotaur in the herd.
 
     public:
 
         /**
-         * @brief Default constructor for the Minotaur class.
+         * @brief Constructs a handle to a minotaur of a herd.
          * 
-         * @details Initializes the Minotaur as alive.
+         * @param herd The herd of the game.
+         * @param index Index of the minotaur in the herd.
          */
-        Minotaur() : alive(true) {}
+        Minotaur(MinotaurHerd* herd, uint32_t index) : herd(herd), index(index) {}
 
         /**
          * @brief Destructor for the Minotaur class.
@@ -42,14 +47,14 @@ class Minotaur {
          * @return true If the Minotaur is alive.
          * @return false If the Minotaur is dead.
          */
-        bool isAlive() const { return alive; }
+        bool isAlive() const { return index < herd->size() && herd->isAlive(index); }
 
         /**
          * @brief Kills the Minotaur.
          * 
          * @details Sets the Minotaur's alive status to false.
          */
-        void kill() { alive = false; }
+        void kill() { if (index < herd->size()) herd->kill(index); }
 
         /**
          * @brief Retrieves the current position of the Minotaur.
@@ -64,6 +69,11 @@ class Minotaur {
          * @param position The new position to set for the Minotaur.
          */
         void setPosition(const Cell& position);
+
+        /**
+         * @brief Retrieves the index of the Minotaur in its herd.
+         */
+        uint32_t getIndex() const { return index; }
 };
 
 #endif // MINOTAUR_H
\ No newline at end of file
@@ -0,0 +1,133 @@
+#ifndef MINOTAUR_HERD_H
+#define MINOTAUR_HERD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief All minotaurs of one game, stored as structure of arrays.
+ *
+ * @details
+ * A minotaur is an index into two parallel arrays, its cell (row * width + col) and its
+ * alive flag, so moving every minotaur in a tick walks contiguous memory. A killed
+ * minotaur keeps its index.
+ *
+ * Whether a cell holds a living minotaur is answered by scanning the cell array while the
+ * herd has at most SCAN_LIMIT minotaurs. Larger herds also keep a sparse cell -> count
+ * table (open addressing, linear probing, at least twice as many entries as minotaurs), so
+ * the memory of a herd grows with the number of minotaurs and never with the size of the
+ * labyrinth.
+ *
+ * Created: 18.10.2026
+ */
+class MinotaurHerd
+{
+    public:
+
+        static constexpr std::size_t SCAN_LIMIT = 16;  ///< Largest herd answered by a scan of the cells.
+
+    private:
+
+        /**
+         * @brief Entry of the sparse occupancy table.
+         */
+        struct Occupancy {
+            uint32_t cell;                  ///< Occupied cell, or EMPTY.
+            uint32_t count;                 ///< Living minotaurs on the cell.
+        };
+
+        static constexpr uint32_t EMPTY = UINT32_MAX;   ///< Cell of a free table entry.
+
+        std::vector<uint32_t> cells;        ///< Cell of each minotaur, row-major.
+        std::vector<uint8_t> alive;         ///< 1 while the minotaur lives.
+        std::vector<Occupancy> occupancy;   ///< Cells with living minotaurs; empty while the herd is scanned.
+        uint32_t width = 0;                 ///< Width of the grid.
+        std::size_t living = 0;             ///< Minotaurs still alive.
+
+        uint32_t home(uint32_t cell) const
+        {
+            const uint32_t mixed = cell * 0x9E3779B1u;
+            return (mixed ^ (mixed >> 16)) & static_cast<uint32_t>(occupancy.size() - 1);
+        }
+
+        /**
+         * @brief Table entry of a cell: the entry holding it, or the free entry that ends its probe.
+         */
+        std::size_t slotOf(uint32_t cell) const;
+
+        /**
+         * @brief Adds one living minotaur to a cell of the table.
+         */
+        void occupy(uint32_t cell);
+
+        /**
+         * @brief Removes one living minotaur from a cell of the table.
+         */
+        void leave(uint32_t cell);
+
+        /**
+         * @brief Rebuilds the table with room for `entries` cells from the living minotaurs.
+         */
+        void rebuild(std::size_t entries);
+
+    public:
+
+        /**
+         * @brief Removes all minotaurs.
+         *
+         * @param width Width of the labyrinth.
+         *
+         * @details The arrays keep their capacity, so restarting a game does not allocate.
+         */
+        void reset(uint32_t width);
+
+        /**
+         * @brief Adds a living minotaur.
+         *
+         * @param cell Its cell, row * width + col.
+         * @return uint32_t The index of the new minotaur.
+         */
+        uint32_t add(uint32_t cell);
+
+        /**
+         * @brief Moves a minotaur to another cell.
+         *
+         * @param index Index of the minotaur.
+         * @param cell The new cell, row * width + col.
+         */
+        void moveTo(uint32_t index, uint32_t cell);
+
+        /**
+         * @brief Kills a minotaur; killing it twice has no effect.
+         *
+         * @param index Index of the minotaur.
+         */
+        void kill(uint32_t index);
+
+        /**
+         * @brief Finds a living minotaur on a cell.
+         *
+         * @param cell The cell, row * width + col.
+         * @return int The lowest index of a living minotaur there, or -1 if the cell is free.
+         *
+         * @details A large herd answers free cells from the table; only an occupied cell
+         *          costs a scan over the minotaurs.
+         */
+        int findAt(uint32_t cell) const;
+
+        /**
+         * @brief Checks whether a living minotaur stands on a cell.
+         */
+        bool isOccupied(uint32_t cell) const;
+
+        std::size_t size() const { return cells.size(); }
+        std::size_t countAlive() const { return living; }
+        bool isAlive(uint32_t index) const { return alive[index] != 0; }
+        uint32_t getCell(uint32_t index) const { return cells[index]; }
+        int getRow(uint32_t index) const { return static_cast<int>(cells[index] / width); }
+        int getCol(uint32_t index) const { return static_cast<int>(cells[index] % width); }
+        uint32_t getWidth() const { return width; }
+};
+
+#endif // MINOTAUR_HERD_H
@@ -0,0 +1,70 @@
+#ifndef OBSERVATION_H
+#define OBSERVATION_H
+
+#include "GameView.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Numeric cell types of the terrain channel of an observation.
+ *
+ * @details Ordered so that every code from FLOOR on can be entered by the entities.
+ */
+enum class TerrainCode : uint8_t {
+    OUTSIDE = 0,    ///< Beyond the border of the labyrinth.
+    WALL = 1,       ///< '#'.
+    ENTRANCE = 2,   ///< 'U'.
+    FLOOR = 3,      ///< Empty cell, also under the player, the minotaur and items.
+    EXIT = 4        ///< 'I'.
+};
+
+/**
+ * @brief Planes of an observation, stored one after the other.
+ */
+enum ObservationChannel : unsigned int {
+    CHANNEL_TERRAIN = 0,    ///< TerrainCode of every cell.
+    CHANNEL_MINOTAUR = 1,   ///< 1 where a living minotaur stands, 0 elsewhere.
+    CHANNEL_ITEMS = 2,      ///< ItemKind + 1 of an item lying in the cell, 0 for none.
+    OBSERVATION_CHANNELS = 3
+};
+
+/**
+ * @brief Maps a labyrinth character to its terrain code; entity characters count as floor.
+ */
+inline TerrainCode terrainCodeOf(char val)
+{
+    switch (val) {
+        case '#': return TerrainCode::WALL;
+        case 'U': return TerrainCode::ENTRANCE;
+        case 'I': return TerrainCode::EXIT;
+        default:  return TerrainCode::FLOOR;
+    }
+}
+
+/**
+ * @brief Number of bytes of one observation window.
+ *
+ * @param radius Cells seen in every direction from the player; 1 matches the fog of war.
+ * @return std::size_t OBSERVATION_CHANNELS planes of (2 * radius + 1)^2 bytes.
+ */
+inline std::size_t observationSize(int radius)
+{
+    const std::size_t side = static_cast<std::size_t>(2 * radius + 1);
+    return OBSERVATION_CHANNELS * side * side;
+}
+
+/**
+ * @brief Fills a caller-provided buffer with the window around the player of a game.
+ *
+ * @param view The game to observe.
+ * @param radius Cells seen in every direction from the player.
+ * @param out Buffer of at least observationSize(radius) bytes.
+ *
+ * @details
+ * Each plane is row-major with the player in the centre. The cells are read straight from
+ * the labyrinth grid into `out`; nothing is allocated. Batched games are observed with
+ * GameBatch::observe().
+ */
+void fillObservation(const GameView& view, int radius, uint8_t* out);
+
+#endif // OBSERVATION_H
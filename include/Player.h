@@ -2,6 +2,7 @@
 #define PLAYER_H
 
 #include "Cell.h"
+#include <cstdint>
 
 // Forward declaration to avoid circular dependency
 class Item;
@@ -13,25 +14,45 @@ class Item;
  * Manages the player's position, active effects, and immunity status.
  * Provides methods to apply and remove various effects obtained from items.
  * 
+ * The effects, immunity included, are bits of one mask with the turn each of them ends
+ * in a small array next to it. Picking up an effect that is already active keeps the
+ * later of the two ends, so the effect lasts until the last item granting it runs out.
+ * 
  * Author: Roman Avanesov
  * Created: 25.12.2024
  * Last Modified: 30.12.2024
  */
 class Player {
 
+    public:
+
+        /**
+         * @brief Effects the player can have; the item effects follow the order of ItemKind.
+         */
+        enum Effect : uint8_t {
+            EFFECT_FOG_OF_WAR = 0,  ///< Visibility reduced to a 3x3 submatrix.
+            EFFECT_HUMMER = 1,      ///< The next wall walked into is broken.
+            EFFECT_SHIELD = 2,      ///< The next attack of the minotaur is absorbed.
+            EFFECT_SWORD = 3,       ///< The minotaur can be killed.
+            EFFECT_IMMUNITY = 4,    ///< The minotaur cannot harm the player.
+            EFFECT_COUNT = 5
+        };
+
+        static constexpr uint32_t NO_EXPIRY = UINT32_MAX;  ///< End turn of an effect that lasts until it is removed.
+
+        /**
+         * @brief Bit of an effect in the mask returned by getEffects().
+         */
+        static constexpr uint8_t effectBit(Effect effect) { return static_cast<uint8_t>(1u << effect); }
+
     private:
 
         Cell position;                  ///< The current position of the player in the labyrinth.
         
-        // Special effects flags
-        bool swordEffect = false;       ///< Indicates if the sword effect is active.
-        bool shieldEffect = false;      ///< Indicates if the shield effect is active.
-        bool hummerEffect = false;      ///< Indicates if the hummer effect is active.
-        bool fogOfWarEffect = false;    ///< Indicates if the fog of war effect is active.
-
-        // Immunity status
-        bool immuneToMinotaur = false;  ///< Indicates if the player is currently immune to the Minotaur.
-        int immuneDuration = 0;          ///< Duration of immunity in turns.
+        // Special effects
+        uint8_t effects = 0;                    ///< effectBit() of every active effect.
+        uint32_t expiry[EFFECT_COUNT] = {};     ///< Turn at which each active effect ends.
+        uint32_t turn = 0;                      ///< Current turn, the clock the end turns refer to.
 
     public:
     
@@ -63,71 +84,151 @@ class Player {
          */
         void setPosition(const Cell& position);
 
+        /**
+         * @brief Retrieves the mask of the active effects.
+         * 
+         * @return uint8_t effectBit() of every active effect.
+         */
+        uint8_t getEffects() const { return effects; }
+
+        /**
+         * @brief Checks if an effect is active.
+         */
+        bool hasEffect(Effect effect) const { return (effects & effectBit(effect)) != 0; }
+
+        /**
+         * @brief Activates an effect until a given turn.
+         * 
+         * @param effect The effect to activate.
+         * @param expiresAt Turn at which the effect ends; NO_EXPIRY keeps it until it is removed.
+         * 
+         * @details If the effect is already active it stacks: the later of both ends is kept.
+         */
+        void addEffect(Effect effect, uint32_t expiresAt = NO_EXPIRY) {
+            if (!hasEffect(effect) || expiresAt > expiry[effect]) {
+                expiry[effect] = expiresAt;
+            }
+            effects |= effectBit(effect);
+        }
+
+        /**
+         * @brief Deactivates an effect, e.g. when it has been used up.
+         */
+        void removeEffect(Effect effect) { effects &= static_cast<uint8_t>(~effectBit(effect)); }
+
+        /**
+         * @brief Retrieves the turn at which an active effect ends.
+         */
+        uint32_t getExpiry(Effect effect) const { return expiry[effect]; }
+
+        /**
+         * @brief Sets the current turn, from which the remaining durations are counted.
+         */
+        void setTurn(uint32_t turn) { this->turn = turn; }
+
+        /**
+         * @brief Retrieves the current turn.
+         */
+        uint32_t getTurn() const { return turn; }
+
+        /**
+         * @brief Computes the mask of the active effects that end by a turn.
+         * 
+         * @param turn The current turn.
+         * @return uint8_t effectBit() of every active effect whose end turn is not after `turn`.
+         */
+        uint8_t expiringBy(uint32_t turn) const {
+            uint8_t due = 0;
+            for (unsigned int effect = 0; effect < EFFECT_COUNT; effect++) {
+                due |= static_cast<uint8_t>((expiry[effect] <= turn) << effect);
+            }
+            return due & effects;
+        }
+
+        /**
+         * @brief Deactivates the effects that end by a turn.
+         * 
+         * @param turn The current turn.
+         * @return uint8_t effectBit() of every effect that was deactivated.
+         */
+        uint8_t expireEffects(uint32_t turn) {
+            this->turn = turn;
+            const uint8_t due = expiringBy(turn);
+            effects &= static_cast<uint8_t>(~due);
+            return due;
+        }
+
         /**
          * @brief Activates the sword effect for the player.
          * 
          * @details Grants the ability to destroy the Minotaur.
          */
-        void addSwordEffect();
+        void addSwordEffect() { addEffect(EFFECT_SWORD); }
 
         /**
          * @brief Deactivates the sword effect for the player.
          * 
          * @details Removes the ability to destroy the Minotaur.
          */
-        void removeSwordEffect();
+        void removeSwordEffect() { removeEffect(EFFECT_SWORD); }
 
         /**
          * @brief Activates the shield effect for the player.
          * 
          * @details Grants the ability to defend against the Minotaur.
          */
-        void addShieldEffect();
+        void addShieldEffect() { addEffect(EFFECT_SHIELD); }
 
         /**
          * @brief Deactivates the shield effect for the player.
          * 
          * @details Removes the ability to defend against the Minotaur.
          */
-        void removeShieldEffect();
+        void removeShieldEffect() { removeEffect(EFFECT_SHIELD); }
 
         /**
          * @brief Activates the hummer effect for the player.
          * 
          * @details Grants the ability to pass through walls.
          */
-        void addHummerEffect();
+        void addHummerEffect() { addEffect(EFFECT_HUMMER); }
 
         /**
          * @brief Deactivates the hummer effect for the player.
          * 
          * @details Removes the ability to pass through walls.
          */
-        void removeHummerEffect();
+        void removeHummerEffect() { removeEffect(EFFECT_HUMMER); }
 
         /**
          * @brief Activates the fog of war effect for the player.
          * 
          * @details Reduces the player's visibility to a 3x3 submatrix.
          */
-        void addFogOfWarEffect();
+        void addFogOfWarEffect() { addEffect(EFFECT_FOG_OF_WAR); }
 
         /**
          * @brief Deactivates the fog of war effect for the player.
          * 
          * @details Restores the player's full visibility in the labyrinth.
          */
-        void removeFogOfWarEffect();
+        void removeFogOfWarEffect() { removeEffect(EFFECT_FOG_OF_WAR); }
 
         /**
          * @brief Sets the player's immunity status against the Minotaur.
          * 
          * @param immune Boolean indicating whether to grant immunity.
-         * @param immuneDuration Duration of immunity in turns.
+         * @param immuneDuration Duration of immunity in turns from the current turn.
+         * 
+         * @details Unlike addEffect(), the end turn is replaced rather than stacked.
          */
         void setImmuneToMinotaur(bool immune, int immuneDuration) {
-            immuneToMinotaur = immune;
-            this->immuneDuration = immuneDuration;
+            if (immune && immuneDuration > 0) {
+                expiry[EFFECT_IMMUNITY] = turn + static_cast<uint32_t>(immuneDuration);
+                effects |= effectBit(EFFECT_IMMUNITY);
+            } else {
+                removeEffect(EFFECT_IMMUNITY);
+            }
         }
 
         /**
@@ -136,26 +237,30 @@ class Player {
          * @return true If the player is immune.
          * @return false Otherwise.
          */
-        bool isImmuneToMinotaur() const { return immuneToMinotaur; }
+        bool isImmuneToMinotaur() const { return hasEffect(EFFECT_IMMUNITY); }
 
         /**
          * @brief Retrieves the remaining duration of the player's immunity.
          * 
-         * @return int Remaining immunity duration in turns.
+         * @return int Turns from the current turn until the immunity ends, 0 if not immune.
          */
-        int getImmuneDuration() const { return immuneDuration; }
+        int getImmuneDuration() const {
+            return isImmuneToMinotaur() && expiry[EFFECT_IMMUNITY] > turn ? static_cast<int>(expiry[EFFECT_IMMUNITY] - turn) : 0;
+        }
 
         /**
-         * @brief Decreases the player's immunity duration by one turn.
+         * @brief Brings the end of the player's immunity one turn closer.
          * 
-         * @details If the immunity duration reaches zero, the player is no longer immune.
+         * @details If the immunity ends by the current turn, the player is no longer immune.
          */
         void decreaseImmuneDuration() { 
-            immuneDuration--; 
-            if (immuneDuration <= 0) {
-                immuneToMinotaur = false; 
-                immuneDuration = 0; // Prevent negative duration
-            } 
+            if (!isImmuneToMinotaur()) {
+                return;
+            }
+            expiry[EFFECT_IMMUNITY]--;
+            if (expiry[EFFECT_IMMUNITY] <= turn) {
+                removeEffect(EFFECT_IMMUNITY);
+            }
         }
 
         /**
@@ -164,7 +269,7 @@ class Player {
          * @return true If the sword effect is active.
          * @return false Otherwise.
          */
-        bool hasSwordEffect() const { return swordEffect; }
+        bool hasSwordEffect() const { return hasEffect(EFFECT_SWORD); }
 
         /**
          * @brief Checks if the shield effect is active.
@@ -172,7 +277,7 @@ class Player {
          * @return true If the shield effect is active.
          * @return false Otherwise.
          */
-        bool hasShieldEffect() const { return shieldEffect; }
+        bool hasShieldEffect() const { return hasEffect(EFFECT_SHIELD); }
 
         /**
          * @brief Checks if the hummer effect is active.
@@ -180,7 +285,7 @@ class Player {
          * @return true If the hummer effect is active.
          * @return false Otherwise.
          */
-        bool hasHummerEffect() const { return hummerEffect; }
+        bool hasHummerEffect() const { return hasEffect(EFFECT_HUMMER); }
 
         /**
          * @brief Checks if the fog of war effect is active.
@@ -188,7 +293,7 @@ class Player {
          * @return true If the fog of war effect is active.
          * @return false Otherwise.
          */
-        bool hasFogOfWarEffect() const { return fogOfWarEffect; }
+        bool hasFogOfWarEffect() const { return hasEffect(EFFECT_FOG_OF_WAR); }
 };
 
 #endif // PLAYER_H
\ No newline at end of file
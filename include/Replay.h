@@ -0,0 +1,161 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Everything besides the actions that is needed to rebuild a game.
+ *
+ * @details
+ * A generated labyrinth is rebuilt from its size and seed; a labyrinth loaded from a file
+ * is loaded again from `labyrinthFile`. The remaining fields are those of GameConfig.
+ */
+struct ReplayHeader {
+    uint32_t width = 0;                 ///< Width of the labyrinth.
+    uint32_t height = 0;                ///< Height of the labyrinth.
+    uint32_t labyrinthSeed = 0;         ///< Seed the labyrinth was generated with.
+    uint32_t seed = 0;                  ///< Seed of the game (spawning, minotaur moves).
+    uint32_t numItems = 0;              ///< Number of items spawned.
+    uint32_t minotaurTicks = 0;         ///< Ticks between two minotaur moves.
+    uint32_t minotaurCount = 0;         ///< Minotaurs spawned.
+    bool chasingMinotaurs = false;      ///< Minotaurs step towards the player.
+    bool reachableItemsOnly = false;    ///< Items only spawn on cells reachable from the start.
+    std::string labyrinthFile;          ///< File the labyrinth was loaded from; empty if generated.
+};
+
+/**
+ * @brief Writes the actions of a game as a compact replay file.
+ *
+ * @details
+ * The file starts with the magic "LBRP" followed by the version and the ReplayHeader
+ * fields, all as LEB128 varints. Every tick in which the player acted is one varint holding
+ * the ticks since the previous record shifted left by ACTION_BITS, or'ed with the action;
+ * ticks without an action are not written. A move made within 15 ticks of the previous one
+ * therefore takes a single byte. A last record with the action END holds the tick at which
+ * the game ended.
+ *
+ * Records are encoded into an in-memory buffer that is written with a single write when it
+ * fills up and when the replay is finished or destroyed.
+ *
+ * Created: 18.10.2026
+ */
+class ReplayWriter {
+    private:
+        static constexpr std::size_t BUFFER_BYTES = 4096;  ///< Bytes buffered before a write.
+
+        std::ofstream file;                 ///< Binary output stream.
+        std::vector<uint8_t> buffer;        ///< Bytes not yet written to the file.
+        uint32_t lastTick = 0;              ///< Tick of the previous record.
+
+        /**
+         * @brief Appends one record to the buffer.
+         */
+        void append(uint32_t tick, uint8_t action);
+
+    public:
+        static constexpr uint16_t VERSION = 2;      ///< Current file format version; 2 since Game draws from SplitMix64.
+        static constexpr unsigned int ACTION_BITS = 3;  ///< Low bits of a record holding the action.
+        static constexpr uint8_t END = 7;           ///< Action of the record that ends the replay.
+        static constexpr uint32_t MAX_FILE_NAME = 4096; ///< Longest labyrinth file name stored in a header.
+
+        ReplayWriter() = default;
+
+        /**
+         * @brief Writes the buffered records and closes the file; an unfinished replay has no END record.
+         */
+        ~ReplayWriter();
+
+        ReplayWriter(const ReplayWriter&) = delete;
+        ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+        /**
+         * @brief Creates the replay file and writes its header.
+         *
+         * @param filename Path of the file to create. An empty name disables the replay.
+         * @param header Parameters of the game; its labyrinth file name may hold at most MAX_FILE_NAME bytes.
+         * @return true If the file was created.
+         */
+        bool open(const std::string& filename, const ReplayHeader& header);
+
+        /**
+         * @brief Records the action played in a tick.
+         *
+         * @param tick Tick the action was played in; ticks never decrease.
+         * @param action The raw PlayerAction; PlayerAction::NONE (0) is not recorded.
+         */
+        void record(uint32_t tick, uint8_t action)
+        {
+            if (action == 0 || !file.is_open()) return;
+            append(tick, action);
+        }
+
+        /**
+         * @brief Writes the END record and closes the file.
+         *
+         * @param tick Tick at which the game ended.
+         */
+        void finish(uint32_t tick);
+
+        /**
+         * @brief Writes all buffered bytes to the file.
+         */
+        void flush();
+
+        bool isOpen() const { return file.is_open(); }
+};
+
+/**
+ * @brief Reads a replay file written by ReplayWriter one record at a time.
+ *
+ * @details
+ * The file is read through a buffered stream, so a replay of any length is played back
+ * without ever being loaded into memory.
+ */
+class ReplayReader {
+    private:
+        std::ifstream file;                 ///< Binary input stream.
+        ReplayHeader header;                ///< Header read when the file was opened.
+        bool valid = false;                 ///< The header was read successfully.
+        bool ended = false;                 ///< The END record was read.
+        uint32_t lastTick = 0;              ///< Tick of the previous record.
+
+    public:
+        /**
+         * @brief Opens a replay file and reads its header.
+         *
+         * @param filename Path of the replay.
+         */
+        explicit ReplayReader(const std::string& filename);
+
+        /**
+         * @brief Reads the next action.
+         *
+         * @param tick Receives the tick the action was played in.
+         * @param action Receives the raw PlayerAction.
+         * @return true If an action was read; false at the END record, at the end of the file
+         *         or on a damaged record.
+         */
+        bool next(uint32_t& tick, uint8_t& action);
+
+        /**
+         * @brief Checks whether the header was read and the records can be played.
+         */
+        bool isValid() const { return valid; }
+
+        /**
+         * @brief Checks whether the END record was reached, i.e. the recorded game was finished.
+         */
+        bool hasEnded() const { return ended; }
+
+        /**
+         * @brief Tick at which the recorded game ended, once hasEnded() is true.
+         */
+        uint32_t getEndTick() const { return lastTick; }
+
+        const ReplayHeader& getHeader() const { return header; }
+};
+
+#endif // REPLAY_H
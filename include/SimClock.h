@@ -0,0 +1,72 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Fixed-timestep simulation clock: maps logical game ticks to wall-clock time.
+ *
+ * @details
+ * The game only ever counts ticks; every rule (the minotaur's moves, item effects) is
+ * expressed in ticks or player turns and never reads the wall clock. The clock decides
+ * when a tick may run: at speed 1 tick t starts TICK_MILLIS * t milliseconds after
+ * start(), at speed s that interval is divided by s, and an unpaced clock never waits.
+ * Deadlines are computed from the start time rather than from the previous tick, so a
+ * slow frame is caught up by the following ones instead of shifting the whole game.
+ *
+ * Because the clock only decides when a tick runs and never what happens in it, a game
+ * with the same seed and the same action per tick ends the same way at any speed.
+ *
+ * Created: 18.10.2026
+ */
+class SimClock
+{
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr unsigned int TICK_MILLIS = 50;                         ///< Length of one tick at speed 1.
+        static constexpr unsigned int TICKS_PER_SECOND = 1000 / TICK_MILLIS;    ///< Ticks in one second at speed 1.
+
+    private:
+
+        double speed;                   ///< Ticks run `speed` times faster than real time; 0 runs them unpaced.
+        Clock::time_point startTime;    ///< Wall-clock time of tick 0.
+
+    public:
+
+        /**
+         * @brief Creates a clock.
+         *
+         * @param speed Speed-up over real time; 0 (or less) advances ticks as fast as possible.
+         */
+        explicit SimClock(double speed = 1.0);
+
+        /**
+         * @brief Makes the current wall-clock time the start of tick 0.
+         */
+        void start();
+
+        /**
+         * @brief Wall-clock time at which a tick starts, relative to start().
+         *
+         * @param tick The tick.
+         * @return Clock::duration Zero for an unpaced clock.
+         */
+        Clock::duration offsetOf(uint64_t tick) const;
+
+        /**
+         * @brief Waits until a tick is due.
+         *
+         * @param tick The tick about to run.
+         *
+         * @details Returns at once if the clock is unpaced or the tick is already late.
+         */
+        void waitForTick(uint64_t tick) const;
+
+        bool isPaced() const { return speed > 0.0; }
+        double getSpeed() const { return speed; }
+};
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,190 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Fixed-size log-linear histogram of durations in nanoseconds.
+ *
+ * @details
+ * Every power of two is split into SUB_BUCKETS linear buckets, so any percentile is
+ * reported with a relative error below 1 / SUB_BUCKETS (about 6%). Recording is a few
+ * arithmetic operations on a fixed array: no samples are stored and nothing is allocated,
+ * so the histogram can run for the whole game.
+ *
+ * Created: 18.10.2026
+ */
+class LatencyHistogram {
+    public:
+        static constexpr unsigned int SUB_BUCKET_BITS = 4;                  ///< log2 of the buckets per power of two.
+        static constexpr unsigned int SUB_BUCKETS = 1u << SUB_BUCKET_BITS;  ///< Buckets per power of two.
+        static constexpr unsigned int RANGES = 64 - SUB_BUCKET_BITS;        ///< Powers of two above the linear range.
+        static constexpr unsigned int BUCKETS = (RANGES + 1) * SUB_BUCKETS; ///< Total number of buckets.
+
+    private:
+        std::array<uint64_t, BUCKETS> counts{};     ///< Samples per bucket.
+        uint64_t total = 0;                         ///< Number of recorded samples.
+        uint64_t sum = 0;                           ///< Sum of all samples (for the mean).
+        uint64_t maximum = 0;                       ///< Largest recorded sample.
+
+        /**
+         * @brief Maps a value to its bucket.
+         */
+        static unsigned int bucketOf(uint64_t value);
+
+        /**
+         * @brief Largest value that falls into a bucket.
+         */
+        static uint64_t upperBoundOf(unsigned int bucket);
+
+    public:
+        /**
+         * @brief Adds a sample.
+         *
+         * @param ns Duration in nanoseconds.
+         */
+        void record(uint64_t ns);
+
+        /**
+         * @brief Retrieves a percentile of the recorded samples.
+         *
+         * @param percent Percentile in the range (0, 100].
+         * @return uint64_t Upper bound of the bucket holding the percentile (never above the maximum), 0 if empty.
+         */
+        uint64_t percentile(double percent) const;
+
+        uint64_t count() const { return total; }
+        uint64_t max() const { return maximum; }
+        uint64_t mean() const { return total ? sum / total : 0; }
+
+        /**
+         * @brief Removes all samples.
+         */
+        void reset();
+
+        /**
+         * @brief Adds all samples of another histogram.
+         */
+        void merge(const LatencyHistogram& other);
+};
+
+/**
+ * @brief Latency histogram of the last few seconds only.
+ *
+ * @details
+ * A ring of WINDOW_SLOTS per-second LatencyHistograms, each tagged with the second it holds.
+ * A slot is cleared when the ring comes round to it for a new second, and window() merges only
+ * the slots of the last WINDOW_SLOTS seconds, so a stall drops out of the percentiles once it is
+ * older than the window, whether or not samples keep arriving.
+ *
+ * Created: 18.10.2026
+ */
+class RollingLatencyHistogram {
+    public:
+        static constexpr unsigned int WINDOW_SLOTS = 10;            ///< Seconds covered by window().
+        static constexpr uint64_t SLOT_NANOS = 1000000000ull;       ///< Length of one slot.
+
+    private:
+        std::array<LatencyHistogram, WINDOW_SLOTS> slots;           ///< Samples of one second each.
+        std::array<uint64_t, WINDOW_SLOTS> slotSecond{};            ///< Second each slot holds, plus one (0 = empty).
+
+    public:
+        /**
+         * @brief Adds a sample.
+         *
+         * @param ns Duration in nanoseconds.
+         * @param atNs Time of the sample in nanoseconds, on any clock that never goes back.
+         */
+        void record(uint64_t ns, uint64_t atNs);
+
+        /**
+         * @brief Merges the samples of the WINDOW_SLOTS seconds up to a time.
+         *
+         * @param atNs Current time, on the clock passed to record().
+         * @return LatencyHistogram The samples of the window.
+         */
+        LatencyHistogram window(uint64_t atNs) const;
+};
+
+/**
+ * @brief Parts of a game loop iteration measured by FrameTelemetry.
+ */
+enum class FramePhase : uint8_t {
+    INPUT,          ///< Polling the keyboard and applying the command.
+    MINOTAUR,       ///< minotaurMovementUpdate().
+    COLLISION,      ///< checkGameObjectCollision().
+    RENDER,         ///< printMap(), the effect lines and flushing the terminal.
+    SLEEP,          ///< Delay at the end of the iteration.
+    FRAME,          ///< Whole iteration.
+    INPUT_LATENCY,  ///< From the keyboard poll before the one that read a key (the earliest the key can have been pressed unseen) to the end of the frame that shows its result; an upper bound.
+    COUNT           ///< Number of phases.
+};
+
+/**
+ * @brief Collects per-phase timings of the game loop and writes them as a report.
+ *
+ * @details
+ * One cumulative LatencyHistogram per FramePhase, over the whole game, and one
+ * RollingLatencyHistogram per phase over the last seconds, so an early stall does not hide
+ * how the game runs now. The game sets the time and records every iteration, and writes the
+ * summary of both to a file when the game ends.
+ *
+ * Created: 18.10.2026
+ */
+class FrameTelemetry {
+    private:
+        std::array<LatencyHistogram, static_cast<std::size_t>(FramePhase::COUNT)> histograms;   ///< One cumulative histogram per phase.
+        std::array<RollingLatencyHistogram, static_cast<std::size_t>(FramePhase::COUNT)> rolling; ///< One windowed histogram per phase.
+        uint64_t now = 0;   ///< Current time in nanoseconds, set with setTime().
+
+    public:
+        /**
+         * @brief Adds a sample to the histogram of a phase.
+         *
+         * @param phase Measured phase.
+         * @param ns Duration in nanoseconds.
+         */
+        void record(FramePhase phase, uint64_t ns)
+        {
+            histograms[static_cast<std::size_t>(phase)].record(ns);
+            rolling[static_cast<std::size_t>(phase)].record(ns, now);
+        }
+
+        /**
+         * @brief Sets the time the following samples are recorded at.
+         *
+         * @param ns Time in nanoseconds, e.g. since the game loop started; it never goes back.
+         */
+        void setTime(uint64_t ns) { now = ns; }
+
+        /**
+         * @brief Retrieves the cumulative histogram of a phase, over the whole game.
+         */
+        const LatencyHistogram& get(FramePhase phase) const { return histograms[static_cast<std::size_t>(phase)]; }
+
+        /**
+         * @brief Retrieves the samples of a phase in the last RollingLatencyHistogram::WINDOW_SLOTS seconds.
+         */
+        LatencyHistogram recent(FramePhase phase) const { return rolling[static_cast<std::size_t>(phase)].window(now); }
+
+        /**
+         * @brief Retrieves the name of a phase used in the report.
+         */
+        static const char* phaseName(FramePhase phase);
+
+        /**
+         * @brief Writes the summary of every phase to a file.
+         *
+         * @param filename File to create or overwrite.
+         * @return true If the file was written.
+         *
+         * @details One line per phase with the sample count and the p50, p95, p99, mean and
+         *          maximum in microseconds over the whole game, followed by the count and the
+         *          p50, p95 and p99 of the last RollingLatencyHistogram::WINDOW_SLOTS seconds.
+         */
+        bool save(const std::string& filename) const;
+};
+
+#endif // TELEMETRY_H
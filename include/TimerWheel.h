@@ -0,0 +1,188 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Hierarchical timer wheel: fires timers when an abstract clock reaches their deadline.
+ *
+ * @details
+ * The clock is whatever the owner advances it by (player turns, game ticks, milliseconds).
+ * Timers sit in LEVELS wheels of SLOTS slots; level l covers deadlines that differ from the
+ * current time only in digit l (base SLOTS) or below. When the clock reaches the start of a
+ * slot of a higher level, that slot is cascaded into the lower levels, and the slot of level 0
+ * for the current time holds exactly the timers due now. Deadlines beyond the range of all
+ * levels wait in an overflow list that is sorted in again once the top level wraps.
+ *
+ * advance() jumps straight to the next occupied slot using one occupancy bitmask per level,
+ * so moving the clock costs only the timers that fire and the slots cascaded on the way,
+ * however many timers are pending and however far the clock moves. Timers due at the same
+ * time fire in the order they were scheduled.
+ *
+ * Created: 18.10.2026
+ */
+class TimerWheel
+{
+    public:
+
+        /**
+         * @brief A timer as handed to the callback of advance().
+         */
+        struct Timer {
+            uint64_t deadline;  ///< Time at which the timer fires.
+            uint32_t id;        ///< Owner-defined id, e.g. an item id.
+            uint8_t type;       ///< Owner-defined type of the timer.
+        };
+
+    private:
+
+        static constexpr unsigned int SLOT_BITS = 6;
+        static constexpr unsigned int SLOTS = 1u << SLOT_BITS;     ///< Slots per level.
+        static constexpr unsigned int LEVELS = 4;                  ///< Levels; they cover 2^24 time units.
+        static constexpr uint32_t NONE = UINT32_MAX;               ///< End of a list.
+
+        /**
+         * @brief A pending timer, linked into the list of its slot.
+         */
+        struct Node {
+            Timer timer;
+            uint32_t next;
+        };
+
+        /**
+         * @brief Singly linked list of nodes, appended at the tail to keep scheduling order.
+         */
+        struct List {
+            uint32_t head = NONE;
+            uint32_t tail = NONE;
+        };
+
+        std::vector<Node> nodes;            ///< Storage of all timers, pending or free.
+        uint32_t freeNodes = NONE;          ///< Free list threaded through `nodes`.
+        List slots[LEVELS][SLOTS];          ///< Pending timers by level and slot.
+        uint64_t occupied[LEVELS] = {};     ///< Bit s set if slot s of the level is not empty.
+        List overflow;                      ///< Timers due beyond the range of the top level.
+        uint64_t now = 0;                   ///< Current time; every timer up to it has fired.
+        std::size_t pendingCount = 0;       ///< Timers scheduled and not fired yet.
+
+        /**
+         * @brief Links a node into the slot its deadline belongs to relative to `now`.
+         */
+        void place(uint32_t node);
+
+        /**
+         * @brief Moves the timers of one slot of a higher level down to the lower levels.
+         */
+        void cascade(unsigned int level, unsigned int slot);
+
+        /**
+         * @brief Sorts the overflow list into the levels again.
+         */
+        void cascadeOverflow();
+
+        /**
+         * @brief Detaches the list of a slot and clears its occupancy bit.
+         */
+        List take(unsigned int level, unsigned int slot);
+
+        /**
+         * @brief Cascades the higher levels whose slot starts at `time`.
+         */
+        void cascadeAt(uint64_t time);
+
+        /**
+         * @brief Earliest time after `now` at which a slot has to be fired or cascaded.
+         *
+         * @details Slots before the current digit of a level are always empty, so the first
+         *          occupied slot after it, searched from level 0 upwards, is the next event.
+         */
+        uint64_t nextEvent() const
+        {
+            for (unsigned int level = 0; level < LEVELS; level++) {
+                const unsigned int shift = level * SLOT_BITS;
+                const unsigned int digit = static_cast<unsigned int>((now >> shift) & (SLOTS - 1));
+                const uint64_t ahead = digit == SLOTS - 1 ? 0 : occupied[level] & (~0ull << (digit + 1));
+                if (ahead != 0) {
+                    const unsigned int above = shift + SLOT_BITS;
+                    return ((now >> above) << above) + (static_cast<uint64_t>(__builtin_ctzll(ahead)) << shift);
+                }
+            }
+            // Nothing left in the levels: the overflow is sorted in when the top level wraps
+            const unsigned int range = LEVELS * SLOT_BITS;
+            return ((now >> range) + 1) << range;
+        }
+
+    public:
+
+        /**
+         * @brief Drops all timers and sets the clock.
+         *
+         * @param time The new current time.
+         *
+         * @details The node storage is kept for reuse.
+         */
+        void reset(uint64_t time = 0);
+
+        /**
+         * @brief Schedules a timer.
+         *
+         * @param deadline Time at which the timer fires; a deadline not after the current
+         *                 time is moved to the next time unit.
+         * @param type Owner-defined type of the timer.
+         * @param id Owner-defined id of the timer.
+         */
+        void schedule(uint64_t deadline, uint8_t type, uint32_t id);
+
+        /**
+         * @brief Moves the clock to `time` and fires every timer due until then.
+         *
+         * @param time The new current time; an earlier time does nothing.
+         * @param fire Callback invoked as fire(const Timer&) for each timer, in deadline order.
+         *
+         * @details The callback may schedule new timers; those due by `time` fire in the
+         *          same call.
+         */
+        template <typename Fire>
+        void advance(uint64_t time, Fire&& fire)
+        {
+            while (pendingCount > 0) {
+                const uint64_t next = nextEvent();
+                if (next > time) {
+                    break;
+                }
+                now = next;
+                if ((now & (SLOTS - 1)) == 0) {
+                    cascadeAt(now);
+                }
+
+                // Every timer left in the slot of `now` at level 0 is due now
+                const List due = take(0, static_cast<unsigned int>(now & (SLOTS - 1)));
+                for (uint32_t node = due.head; node != NONE; ) {
+                    const Timer timer = nodes[node].timer;
+                    const uint32_t following = nodes[node].next;
+                    nodes[node].next = freeNodes;
+                    freeNodes = node;
+                    pendingCount--;
+                    fire(timer);
+                    node = following;
+                }
+            }
+            if (time > now) {
+                now = time;
+            }
+        }
+
+        /**
+         * @brief Current time of the wheel.
+         */
+        uint64_t getTime() const { return now; }
+
+        /**
+         * @brief Number of timers that have not fired yet.
+         */
+        std::size_t pending() const { return pendingCount; }
+};
+
+#endif // TIMER_WHEEL_H
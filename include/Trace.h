@@ -0,0 +1,143 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Collects timed spans and writes them in the Chrome Trace Event Format.
+ *
+ * @details
+ * The resulting JSON file opens in chrome://tracing and in Perfetto, where nested
+ * spans of the same thread are shown as a flame chart. Every thread records into its
+ * own buffer without locking; the mutex is only taken the first time a thread records
+ * into a tracer it has not used recently and when the trace is saved. A thread may record
+ * into several tracers; each keeps one buffer per thread. Span names must be string literals (only the pointer is stored).
+ *
+ * Spans are normally recorded with the TRACE_SCOPE macro, which is compiled out unless the
+ * project is configured with -DLABYRINTH_TRACE=ON. The global tracer then writes `trace.json`
+ * (or the file named by the LABYRINTH_TRACE_FILE environment variable) when the program exits.
+ *
+ * Created: 18.10.2026
+ */
+class Tracer {
+    private:
+        /**
+         * @brief One complete ("X") event.
+         */
+        struct Span {
+            const char* name;       ///< Static span name.
+            uint64_t startNs;       ///< Start relative to the program start.
+            uint64_t durationNs;    ///< Duration of the span.
+        };
+
+        /**
+         * @brief Spans recorded by one thread.
+         */
+        struct ThreadBuffer {
+            std::thread::id owner;      ///< Thread recording into the buffer.
+            uint32_t threadId;          ///< Sequential id shown as `tid` in the trace.
+            std::vector<Span> spans;    ///< Recorded spans in completion order.
+        };
+
+        const uint64_t id;                                      ///< Distinguishes tracers in the per-thread caches; never reused.
+        std::string outputFile;                                 ///< File written by the destructor, empty for none.
+        std::mutex buffersMutex;                                ///< Guards `buffers`.
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;     ///< One buffer per recording thread.
+
+        /**
+         * @brief Retrieves the buffer of the calling thread, registering it on first use.
+         *
+         * @details Every thread caches the buffers of the tracers it recorded into last; on a
+         * cache miss the buffer is looked up by thread in `buffers`.
+         */
+        ThreadBuffer& threadBuffer();
+
+    public:
+        /**
+         * @brief Creates an empty tracer.
+         *
+         * @param outputFile File written when the tracer is destroyed; empty to write nothing.
+         */
+        explicit Tracer(const std::string& outputFile = "");
+
+        /**
+         * @brief Writes the trace to the output file, if one was given.
+         */
+        ~Tracer();
+
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+
+        /**
+         * @brief Retrieves the tracer used by TRACE_SCOPE.
+         */
+        static Tracer& instance();
+
+        /**
+         * @brief Reads the monotonic clock.
+         *
+         * @return uint64_t Nanoseconds since an arbitrary epoch.
+         */
+        static uint64_t nowNs();
+
+        /**
+         * @brief Records a finished span for the calling thread.
+         *
+         * @param name Static span name.
+         * @param startNs Start of the span as returned by nowNs().
+         * @param endNs End of the span as returned by nowNs().
+         */
+        void record(const char* name, uint64_t startNs, uint64_t endNs);
+
+        /**
+         * @brief Writes all recorded spans as a Trace Event Format JSON object.
+         *
+         * @param filename File to create or overwrite.
+         * @return true If the file was written.
+         *
+         * @details Must not run concurrently with threads that are still recording.
+         */
+        bool save(const std::string& filename);
+
+        /**
+         * @brief Counts the recorded spans of all threads.
+         */
+        std::size_t spanCount();
+};
+
+/**
+ * @brief Records the lifetime of a scope as a span of the global tracer.
+ */
+class TraceScope {
+    private:
+        const char* name;   ///< Static span name.
+        uint64_t startNs;   ///< Clock value at construction.
+
+    public:
+        explicit TraceScope(const char* name) : name(name), startNs(Tracer::nowNs()) {}
+        ~TraceScope() { Tracer::instance().record(name, startNs, Tracer::nowNs()); }
+
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+/**
+ * @brief Records the enclosing scope as a span named `name` (a string literal).
+ *
+ * @details Expands to nothing unless LABYRINTH_TRACE is defined to a non-zero value.
+ */
+#if defined(LABYRINTH_TRACE) && LABYRINTH_TRACE
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name) do {} while (0)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,76 @@
+#ifndef DISTANCE_FIELD_H
+#define DISTANCE_FIELD_H
+
+#include "Game.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Breadth-first distances over the walkable cells of a game, shared by the bots.
+ * 
+ * @details 
+ * Distances are measured from one or more source cells in player moves. Because moves are
+ * reversible, stepping to the neighbour with the smallest distance walks a shortest path
+ * towards the nearest source. The distance and queue buffers are sized on the first use
+ * for a grid and reused afterwards, so recomputing the field does not allocate.
+ * 
+ * Created: 18.10.2026
+ */
+class DistanceField
+{
+    public:
+
+        static constexpr uint32_t UNREACHABLE = UINT32_MAX;    ///< Distance of cells no source can reach.
+
+    private:
+
+        std::vector<uint32_t> distances;    ///< Distance per cell, row-major.
+        std::vector<uint32_t> queue;        ///< BFS queue of cell indices, one slot per cell.
+        std::size_t queueTail = 0;          ///< Number of cells queued by addSource().
+        int width = 0;                      ///< Width of the grid of the last computation.
+        int height = 0;                     ///< Height of the grid of the last computation.
+
+    public:
+
+        /**
+         * @brief Clears the field for a new computation on the grid of `view`.
+         */
+        void begin(const GameView& view);
+
+        /**
+         * @brief Adds a source cell with distance 0; ignored if it is not walkable or already added.
+         */
+        void addSource(const GameView& view, int row, int col);
+
+        /**
+         * @brief Propagates the distances from all added sources.
+         */
+        void run(const GameView& view);
+
+        /**
+         * @brief Retrieves the distance of a cell, UNREACHABLE outside the grid or the reachable area.
+         */
+        uint32_t at(int row, int col) const
+        {
+            if (row < 0 || row >= height || col < 0 || col >= width) {
+                return UNREACHABLE;
+            }
+            return distances[static_cast<std::size_t>(row) * width + col];
+        }
+
+        /**
+         * @brief Chooses the move from a cell to the neighbour closest to a source.
+         * 
+         * @return PlayerAction The move, or PlayerAction::NONE if no neighbour is closer than the cell itself.
+         */
+        PlayerAction stepFrom(int row, int col) const;
+
+        /**
+         * @brief Offsets of the four moves, in the order UP, DOWN, LEFT, RIGHT.
+         */
+        static const int ROW_OFFSETS[4];
+        static const int COL_OFFSETS[4];
+        static const PlayerAction MOVES[4];
+};
+
+#endif // DISTANCE_FIELD_H
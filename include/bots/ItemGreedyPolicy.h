@@ -0,0 +1,37 @@
+#ifndef ITEM_GREEDY_POLICY_H
+#define ITEM_GREEDY_POLICY_H
+
+#include "bots/PlayerPolicy.h"
+#include "bots/DistanceField.h"
+#include <cstddef>
+
+/**
+ * @brief Policy that collects every reachable item before heading to the exit.
+ * 
+ * @details 
+ * The player walks to the nearest item still lying in the labyrinth; once none is left
+ * (or none can be reached) it runs to the exit. The distances to the items are only
+ * recomputed when an item was picked up or destroyed. With the sword, the minotaur is
+ * attacked as soon as it comes within reach.
+ * 
+ * Created: 18.10.2026
+ */
+class ItemGreedyPolicy : public PlayerPolicy
+{
+    private:
+
+        DistanceField toItems;          ///< Distances to the nearest item left.
+        DistanceField toExit;           ///< Distances to the exit.
+        std::size_t itemsLeft = 0;      ///< Items lying in the labyrinth when `toItems` was computed.
+        bool stale = true;              ///< The fields belong to a previous game.
+
+    public:
+
+        void reset(unsigned int seed) override;
+
+        PlayerAction nextAction(const GameView& view) override;
+
+        const char* getName() const override { return "item-greedy"; }
+};
+
+#endif // ITEM_GREEDY_POLICY_H
@@ -0,0 +1,34 @@
+#ifndef MINOTAUR_AVOIDING_POLICY_H
+#define MINOTAUR_AVOIDING_POLICY_H
+
+#include "bots/PlayerPolicy.h"
+#include "bots/DistanceField.h"
+
+/**
+ * @brief Policy that heads for the exit but keeps away from the minotaur.
+ * 
+ * @details 
+ * Follows the shortest path to the exit, except that it never ends a move next to the
+ * living minotaur while the player is vulnerable (no shield, no immunity): it then takes
+ * the safe cell closest to the exit, waits, or flees if every option is dangerous.
+ * With the sword, the minotaur is attacked as soon as it comes within reach.
+ * 
+ * Created: 18.10.2026
+ */
+class MinotaurAvoidingPolicy : public PlayerPolicy
+{
+    private:
+
+        DistanceField toExit;   ///< Distances to the exit of the current game.
+        bool stale = true;      ///< The field belongs to a previous game.
+
+    public:
+
+        void reset(unsigned int seed) override;
+
+        PlayerAction nextAction(const GameView& view) override;
+
+        const char* getName() const override { return "minotaur-avoiding"; }
+};
+
+#endif // MINOTAUR_AVOIDING_POLICY_H
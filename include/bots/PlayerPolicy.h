@@ -0,0 +1,69 @@
+#ifndef PLAYER_POLICY_H
+#define PLAYER_POLICY_H
+
+#include "Game.h"
+
+/**
+ * @brief Abstract base class of automated players.
+ * 
+ * @details 
+ * A policy looks at a read-only GameView of a running game and decides the action for
+ * the next tick, which the caller passes to Game::step(). Policies are used by the
+ * headless simulation (labyrinth-sim); one policy instance plays one game at a time.
+ * nextAction() runs every tick, so implementations keep their scratch memory between
+ * calls and must not allocate in it.
+ * 
+ * Created: 18.10.2026
+ */
+class PlayerPolicy
+{
+    public:
+
+        virtual ~PlayerPolicy() = default;
+
+        /**
+         * @brief Prepares the policy for a new game.
+         * 
+         * @param seed Seed for any randomness of the policy, so a simulated game is reproducible.
+         */
+        virtual void reset(unsigned int seed) = 0;
+
+        /**
+         * @brief Decides the action of the next tick.
+         * 
+         * @param view The game being played, as returned by Game::getView().
+         * @return PlayerAction The action to pass to Game::step().
+         */
+        virtual PlayerAction nextAction(const GameView& view) = 0;
+
+        /**
+         * @brief Retrieves the name of the policy used on the command line and in reports.
+         */
+        virtual const char* getName() const = 0;
+
+    protected:
+
+        /**
+         * @brief Checks whether an attack this tick would kill a minotaur.
+         * 
+         * @return true If the player holds the sword and a living minotaur is on the player's cell or one of the 8 surrounding cells.
+         */
+        static bool canKillMinotaur(const GameView& view)
+        {
+            const MinotaurHerd& minotaurs = view.getMinotaurs();
+            if (!view.getPlayer().hasSwordEffect() || minotaurs.countAlive() == 0) {
+                return false;
+            }
+            const Cell player = view.getPlayer().getPosition();
+            for (int row = player.getRow() - 1; row <= player.getRow() + 1; row++) {
+                for (int col = player.getCol() - 1; col <= player.getCol() + 1; col++) {
+                    if (view.inBounds(row, col) && minotaurs.isOccupied(static_cast<uint32_t>(row * view.getWidth() + col))) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+};
+
+#endif // PLAYER_POLICY_H
@@ -0,0 +1,37 @@
+#ifndef RANDOM_POLICY_H
+#define RANDOM_POLICY_H
+
+#include "bots/PlayerPolicy.h"
+#include <random>
+
+/**
+ * @brief Policy that moves in a random direction every tick.
+ * 
+ * @details 
+ * Each tick one of the four moves is chosen uniformly; when the player holds the sword,
+ * an attack is tried instead with a small probability. Serves as the baseline the other
+ * policies are compared against.
+ * 
+ * Created: 18.10.2026
+ */
+class RandomPolicy : public PlayerPolicy
+{
+    private:
+
+        std::mt19937 rng;   ///< Random generator of the current game.
+
+    public:
+
+        /**
+         * @brief Constructs a RandomPolicy seeded with 0; call reset() before every game.
+         */
+        RandomPolicy();
+
+        void reset(unsigned int seed) override;
+
+        PlayerAction nextAction(const GameView& view) override;
+
+        const char* getName() const override { return "random"; }
+};
+
+#endif // RANDOM_POLICY_H
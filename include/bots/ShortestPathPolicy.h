@@ -0,0 +1,32 @@
+#ifndef SHORTEST_PATH_POLICY_H
+#define SHORTEST_PATH_POLICY_H
+
+#include "bots/PlayerPolicy.h"
+#include "bots/DistanceField.h"
+
+/**
+ * @brief Policy that runs straight to the exit along a shortest path.
+ * 
+ * @details 
+ * The distances to the exit are computed once per game; every tick the player steps to
+ * the neighbour closest to the exit. Items and the minotaur are ignored.
+ * 
+ * Created: 18.10.2026
+ */
+class ShortestPathPolicy : public PlayerPolicy
+{
+    private:
+
+        DistanceField toExit;   ///< Distances to the exit of the current game.
+        bool stale = true;      ///< The field belongs to a previous game.
+
+    public:
+
+        void reset(unsigned int seed) override;
+
+        PlayerAction nextAction(const GameView& view) override;
+
+        const char* getName() const override { return "shortest-path"; }
+};
+
+#endif // SHORTEST_PATH_POLICY_H
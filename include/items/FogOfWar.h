@@ -8,7 +8,7 @@
  * @brief Represents the Fog of War item within the labyrinth.
  * 
  * @details 
- * The FogOfWar class inherits from the abstract Item class and implements the specific
+ * The FogOfWar class constructs an Item of kind ItemKind::FOG_OF_WAR, which selects the
  * behavior for the Fog of War effect. When activated, this effect limits the player's
  * visibility within the labyrinth, typically restricting it to a certain radius around
  * the player's current position.
@@ -19,33 +19,7 @@
  */
 class FogOfWar : public Item
 {
-    private:
-
     public:
-        /**
-         * @brief Applies the Fog of War effect to the player.
-         * 
-         * @param player Reference to the Player object to which the effect is applied.
-         * 
-         * @details 
-         * Activates the Fog of War effect by invoking the player's `addFogOfWarEffect` method.
-         * This effect typically restricts the player's visibility within the labyrinth, enhancing
-         * the game's challenge by limiting the player's awareness of their surroundings.
-         */
-        void applyEffect(Player& player) override;
-
-        /**
-         * @brief Removes the Fog of War effect from the player.
-         * 
-         * @param player Reference to the Player object from which the effect is removed.
-         * 
-         * @details 
-         * Deactivates the Fog of War effect by invoking the player's `removeFogOfWarEffect` method.
-         * This restores the player's full visibility within the labyrinth, removing any restrictions
-         * imposed by the effect.
-         */
-        void removeEffect(Player& player) override;
-
         /**
          * @brief Constructs a FogOfWar item with a specified position and effect duration.
          * 
@@ -54,26 +28,11 @@ class FogOfWar : public Item
          * 
          * @details 
          * Initializes the FogOfWar item by calling the base Item class constructor with the given
-         * position and effect duration. Sets the `takeMessage`, `removeMessage`, and `infoMessage`
-         * to provide feedback to the player when interacting with the item.
+         * position and effect duration and the kind ItemKind::FOG_OF_WAR; the effect and the
+         * feedback messages are selected by that kind.
          */
         FogOfWar(Cell pos, int effectDuration = 3) 
-            : Item(pos, effectDuration) 
-        { 
-            takeMessage = "Fog of War effect applied."; 
-            removeMessage = "Fog of War effect removed."; 
-            infoMessage = "Fog of War effect active."; 
-        };
-
-        /**
-         * @brief Destructor for the FogOfWar class.
-         * 
-         * @details 
-         * Currently does not perform any specific actions as there are no dynamically allocated resources.
-         * This destructor is declared as `override` to ensure proper cleanup in case the base class destructor
-         * becomes virtual in the future.
-         */
-        ~FogOfWar() override;
+            : Item(ItemKind::FOG_OF_WAR, pos, effectDuration) {};
 };
 
 #endif // FOGOFWAR_H
\ No newline at end of file
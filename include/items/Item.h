@@ -5,15 +5,52 @@
 #include "Player.h"
 #include <iostream>
 #include <string>
+#include <cstdint>
 
 /**
- * @brief Abstract base class representing an item within the labyrinth.
+ * @brief Identifies the concrete type of an item.
  * 
  * @details 
- * The Item class serves as a base for various types of items that can be found
- * within the labyrinth. Each item has a position, effect duration, and state flags
- * indicating whether it is active or has been used. Derived classes must implement
- * the `applyEffect` and `removeEffect` methods to define specific behaviors.
+ * Used wherever the item type has to be stored or transmitted as plain data,
+ * e.g. in the binary event log.
+ */
+enum class ItemKind : uint8_t {
+    FOG_OF_WAR = 0, ///< FogOfWar item.
+    HUMMER = 1,     ///< Hummer item.
+    SHIELD = 2,     ///< Shield item.
+    SWORD = 3       ///< Sword item.
+};
+
+static_assert(static_cast<int>(ItemKind::FOG_OF_WAR) == Player::EFFECT_FOG_OF_WAR &&
+              static_cast<int>(ItemKind::HUMMER) == Player::EFFECT_HUMMER &&
+              static_cast<int>(ItemKind::SHIELD) == Player::EFFECT_SHIELD &&
+              static_cast<int>(ItemKind::SWORD) == Player::EFFECT_SWORD,
+              "Item kinds and player effects must share their order");
+
+/**
+ * @brief Texts shared by all items of one kind.
+ * 
+ * @details 
+ * One static descriptor exists per ItemKind, so items no longer carry their own copies
+ * of the messages.
+ */
+struct ItemDescriptor {
+    const char* name;           ///< Name of the kind, e.g. "Sword".
+    const char* takeMessage;    ///< Message displayed when the player picks up the item.
+    const char* removeMessage;  ///< Message displayed when the item's effect is removed.
+    const char* infoMessage;    ///< Informational message about the item.
+};
+
+/**
+ * @brief An item within the labyrinth, stored as a plain tagged value.
+ * 
+ * @details 
+ * Each item has a position, its kind, an effect duration, and state flags indicating
+ * whether it is active or has been used. The kind tag is the player effect the item grants
+ * (Player::Effect follows the order of ItemKind), so `applyEffect` and `removeEffect` set or
+ * clear one bit of the player's effect mask. Items have no virtual functions, can be copied
+ * and stored by value, and the dispatch is inlined at the call site. The classes
+ * FogOfWar, Hummer, Shield and Sword only construct items of their kind.
  * 
  * Author: Roman Avanesov
  * Created: 25.12.2024
@@ -24,12 +61,10 @@ class Item
     protected:
 
         Cell position;              ///< The position of the item within the labyrinth.
+        ItemKind kind;              ///< The type of the item; selects its effect and texts.
         int effectDuration;         ///< The duration for which the item's effect remains active.
         bool active;                ///< Flag indicating whether the item's effect is currently active.
         bool used;                  ///< Flag indicating whether the item has been used.
-        std::string takeMessage;    ///< Message displayed when the player picks up the item.
-        std::string removeMessage;  ///< Message displayed when the item's effect is removed.
-        std::string infoMessage;    ///< Informational message about the item.
 
     public:
 
@@ -37,12 +72,16 @@ class Item
          * @brief Applies the item's effect to the player.
          * 
          * @param player Reference to the player object to which the effect is applied.
+         * @param expiresAt Turn at which the effect ends; by default it lasts until it is removed.
          * 
          * @details 
-         * This pure virtual function must be overridden by derived classes to implement
-         * specific behaviors when the player picks up the item.
+         * Sets the player's effect bit that matches the item's kind; an effect that is
+         * already active keeps the later end.
          */
-        virtual void applyEffect(Player& player) = 0;
+        void applyEffect(Player& player, uint32_t expiresAt = Player::NO_EXPIRY) const
+        {
+            player.addEffect(effectOf(kind), expiresAt);
+        }
 
         /**
          * @brief Removes the item's effect from the player.
@@ -50,10 +89,14 @@ class Item
          * @param player Reference to the player object from which the effect is removed.
          * 
          * @details 
-         * This pure virtual function must be overridden by derived classes to implement
-         * the removal of specific effects when the item's duration expires or it is deactivated.
+         * Clears the player's effect bit that matches the item's kind.
          */
-        virtual void removeEffect(Player& player) = 0;
+        void removeEffect(Player& player) const { player.removeEffect(effectOf(kind)); }
+
+        /**
+         * @brief Maps an item kind to the player effect it grants.
+         */
+        static constexpr Player::Effect effectOf(ItemKind kind) { return static_cast<Player::Effect>(kind); }
         
         /**
          * @brief Activates the item's effect.
@@ -81,7 +124,7 @@ class Item
          * Allows other components to determine whether the item is still available for use
          * or has already been consumed.
          */
-        bool isUsed();
+        bool isUsed() const;
 
         /**
          * @brief Marks the item as used.
@@ -142,12 +185,32 @@ class Item
          * Allows the game to track and decrement the `effectDuration`, ensuring that effects expire appropriately.
          */
         int getEffectDuration() const;
+
+        /**
+         * @brief Retrieves the concrete type of the item.
+         * 
+         * @return ItemKind The kind of the item.
+         */
+        ItemKind getKind() const { return kind; }
+
+        /**
+         * @brief Retrieves the texts shared by all items of a kind.
+         * 
+         * @param kind The kind of item.
+         * @return const ItemDescriptor& The static descriptor of the kind.
+         */
+        static const ItemDescriptor& describe(ItemKind kind);
+
+        /**
+         * @brief Retrieves the texts of this item's kind.
+         */
+        const ItemDescriptor& getDescriptor() const { return describe(kind); }
     
         /**
          * @brief Displays the informational message associated with the item.
          * 
          * @details 
-         * Outputs the `infoMessage` to the console with a yellow background for visibility.
+         * Outputs the info message of the item's kind to the console with a yellow background for visibility.
          * This message typically describes the item's effect or usage instructions.
          */
         void printInfoMessage();
@@ -156,7 +219,7 @@ class Item
          * @brief Displays the message when the player picks up the item.
          * 
          * @details 
-         * Outputs the `takeMessage` to the console with a yellow background, informing the player about the successful acquisition of the item.
+         * Outputs the take message of the item's kind to the console with a yellow background, informing the player about the successful acquisition of the item.
          */
         void printTakeMessage();
 
@@ -164,25 +227,27 @@ class Item
          * @brief Displays the message when the item's effect is removed.
          * 
          * @details 
-         * Outputs the `removeMessage` to the console with a yellow background, notifying the player that the item's effect has expired or been deactivated.
+         * Outputs the remove message of the item's kind to the console with a yellow background, notifying the player that the item's effect has expired or been deactivated.
          */
         void printRemoveMessage();
 
         /**
-         * @brief Constructs an Item object with a specified position and effect duration.
+         * @brief Constructs an Item object with a specified kind, position and effect duration.
          * 
+         * @param kind The kind of item.
          * @param position The `Cell` object representing the item's position within the labyrinth.
          * @param effectDuration The duration for which the item's effect remains active. Defaults to 3.
          * 
          * @details 
          * Initializes the item with the given position and effect duration. Sets the `active` and `used` flags to `false`.
          */
-        Item(Cell position, int effectDuration = 3) 
-            : position(position), effectDuration(effectDuration), active(false), used(false) {};
+        Item(ItemKind kind, Cell position, int effectDuration = 3) 
+            : position(position), kind(kind), effectDuration(effectDuration), active(false), used(false) {};
 
         /**
-         * @brief Constructs an Item object with specified row and column indices and effect duration.
+         * @brief Constructs an Item object with specified kind, row and column indices and effect duration.
          * 
+         * @param kind The kind of item.
          * @param row The row index of the item's position within the labyrinth.
          * @param col The column index of the item's position within the labyrinth.
          * @param effectDuration The duration for which the item's effect remains active. Defaults to 3.
@@ -191,17 +256,8 @@ class Item
          * Initializes the item with the given row and column indices, creating a `Cell` object for its position.
          * Sets the `active` and `used` flags to `false`.
          */
-        Item(int row, int col, int effectDuration = 3) 
-            : position(row, col, 'P'), effectDuration(effectDuration), active(false), used(false) {};
-        
-        /**
-         * @brief Virtual destructor for the Item class.
-         * 
-         * @details 
-         * Ensures that derived class destructors are called appropriately when deleting objects through base class pointers.
-         */
-        virtual ~Item();
-    
+        Item(ItemKind kind, int row, int col, int effectDuration = 3) 
+            : position(row, col, 'P'), kind(kind), effectDuration(effectDuration), active(false), used(false) {};
 };
 
 #endif // ITEM_H
\ No newline at end of file
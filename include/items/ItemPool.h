@@ -0,0 +1,205 @@
+#ifndef ITEM_POOL_H
+#define ITEM_POOL_H
+
+#include "items/Item.h"
+#include "items/FogOfWar.h"
+#include "items/Hummer.h"
+#include "items/Shield.h"
+#include "items/Sword.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+/**
+ * @brief Contiguous storage for the items of one game, addressed by stable ids.
+ *
+ * @details
+ * All items live by value in one block, allocated by reset() for the number of items
+ * about to be spawned, so spawning any number of items costs a single allocation and
+ * iterating them walks contiguous memory. An item's id is its index and never changes.
+ *
+ * Besides the slots the pool keeps an order array whose first liveCount() entries are the
+ * ids of the items still lying in the labyrinth. retire() moves an id behind that range in
+ * O(1), so scans over the lying items never visit used ones.
+ *
+ * Items created with a cell are also indexed by it in an open-addressing table with linear
+ * probing, at least twice as large as the pool and kept in the same block, so looking up
+ * the item on a cell never allocates. retire() leaves a tombstone in the table.
+ *
+ * Created: 18.10.2026
+ */
+class ItemPool
+{
+    private:
+
+        /**
+         * @brief Raw storage for one item.
+         */
+        struct alignas(Item) Slot {
+            unsigned char bytes[sizeof(Item)];
+        };
+
+        static constexpr uint32_t EMPTY = UINT32_MAX;          ///< Table entry never used since the last clear().
+        static constexpr uint32_t TOMBSTONE = UINT32_MAX - 1;  ///< Table entry of a retired item.
+
+        std::unique_ptr<Slot[]> slots;              ///< Storage of all items (slot i holds item i), followed by the id arrays.
+        uint32_t* order = nullptr;                  ///< Item ids, lying items first; points into the slot block.
+        uint32_t* orderIndex = nullptr;             ///< Position of each item id in `order`; points into the slot block.
+        uint32_t* cells = nullptr;                  ///< Cell of each item id, or NO_CELL; points into the slot block.
+        uint32_t* table = nullptr;                  ///< Cell -> item id table, EMPTY or TOMBSTONE if free; points into the slot block.
+        uint32_t tableMask = 0;                     ///< Number of table entries minus one; the table size is a power of two.
+        uint32_t capacity = 0;                      ///< Number of slots.
+        uint32_t count = 0;                         ///< Items created.
+        uint32_t live = 0;                          ///< Items not yet used.
+
+        Item* slot(uint32_t id) { return reinterpret_cast<Item*>(slots[id].bytes); }
+        const Item* slot(uint32_t id) const { return reinterpret_cast<const Item*>(slots[id].bytes); }
+
+        /**
+         * @brief First table entry to probe for a cell.
+         */
+        uint32_t home(uint32_t cell) const
+        {
+            const uint32_t mixed = cell * 0x9E3779B1u;
+            return (mixed ^ (mixed >> 16)) & tableMask;
+        }
+
+    public:
+
+        static constexpr uint32_t NO_CELL = UINT32_MAX;        ///< Cell of an item that is not indexed.
+
+        /**
+         * @brief Range of item ids, usable in range-based for loops.
+         */
+        struct IdRange {
+            const uint32_t* first;
+            const uint32_t* last;
+            const uint32_t* begin() const { return first; }
+            const uint32_t* end() const { return last; }
+            std::size_t size() const { return static_cast<std::size_t>(last - first); }
+        };
+
+        ItemPool() = default;
+        ItemPool(const ItemPool&) = delete;
+        ItemPool& operator=(const ItemPool&) = delete;
+
+        /**
+         * @brief Destroys all items.
+         */
+        ~ItemPool() { clear(); }
+
+        /**
+         * @brief Destroys all items and makes room for `capacity` new ones.
+         *
+         * @param capacity Number of items that will be created.
+         *
+         * @details Memory is only allocated if the current block is too small.
+         */
+        void reset(std::size_t capacity);
+
+        /**
+         * @brief Destroys all items, keeping the memory for reuse.
+         */
+        void clear();
+
+        /**
+         * @brief Copies an item into the next free slot.
+         *
+         * @param item The item; it is expected to lie in the labyrinth.
+         * @param cell Cell index under which at() finds the item, or NO_CELL; one item per cell.
+         * @return int The id of the new item, or -1 if the pool is full.
+         */
+        int create(const Item& item, uint32_t cell = NO_CELL)
+        {
+            if (count == capacity) {
+                return -1;
+            }
+            const uint32_t id = count++;
+            new (slots[id].bytes) Item(item);
+
+            cells[id] = cell;
+            if (cell != NO_CELL) {
+                uint32_t entry = home(cell);
+                while (table[entry] < TOMBSTONE) {
+                    entry = (entry + 1) & tableMask;
+                }
+                table[entry] = id;
+            }
+
+            // The new item lies in the labyrinth: the first retired id moves to the back
+            if (live < id) {
+                order[id] = order[live];
+                orderIndex[order[id]] = id;
+            }
+            order[live] = id;
+            orderIndex[id] = live++;
+            return static_cast<int>(id);
+        }
+
+        /**
+         * @brief Creates an item with the kind of T (FogOfWar, Hummer, Shield or Sword).
+         *
+         * @param position Position of the item.
+         * @return int The id of the new item, or -1 if the pool is full.
+         */
+        template <typename T>
+        int create(const Cell& position)
+        {
+            static_assert(std::is_base_of<Item, T>::value && sizeof(T) == sizeof(Item), "T must be an item kind");
+            return create(T(position));
+        }
+
+        /**
+         * @brief Marks an item as used and moves it out of the range of lying items.
+         *
+         * @param id Id of the item; retiring an item twice has no effect.
+         */
+        void retire(uint32_t id);
+
+        /**
+         * @brief Looks up the lying item on a cell.
+         *
+         * @param cell Cell index the item was created with.
+         * @return int The id of the item, or -1 if no lying item is indexed on the cell.
+         */
+        int at(uint32_t cell) const
+        {
+            if (live == 0) {
+                return -1;
+            }
+            for (uint32_t entry = home(cell); table[entry] != EMPTY; entry = (entry + 1) & tableMask) {
+                const uint32_t id = table[entry];
+                if (id != TOMBSTONE && cells[id] == cell) {
+                    return static_cast<int>(id);
+                }
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Cell an item was created with, or NO_CELL.
+         */
+        uint32_t cellOf(uint32_t id) const { return cells[id]; }
+
+        Item& operator[](uint32_t id) { return *slot(id); }
+        const Item& operator[](uint32_t id) const { return *slot(id); }
+
+        /**
+         * @brief Number of items created, used or not; ids run from 0 to size() - 1.
+         */
+        std::size_t size() const { return count; }
+
+        /**
+         * @brief Number of items still lying in the labyrinth.
+         */
+        std::size_t liveCount() const { return live; }
+
+        /**
+         * @brief Ids of the items still lying in the labyrinth, in no particular order.
+         */
+        IdRange lying() const { return IdRange{ order, order + live }; }
+};
+
+#endif // ITEM_POOL_H
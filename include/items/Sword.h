@@ -8,7 +8,7 @@
  * @brief Represents the Sword item within the labyrinth.
  * 
  * @details 
- * The Sword class inherits from the abstract Item class and implements the specific
+ * The Sword class constructs an Item of kind ItemKind::SWORD, which selects the
  * behavior for the Sword effect. When activated, this effect enhances the player's
  * ability to attack enemies within a certain range, providing increased damage or
  * attack capabilities against adversaries like the minotaur.
@@ -19,33 +19,7 @@
  */
 class Sword : public Item
 {
-    private:
-
     public:
-        /**
-         * @brief Applies the Sword effect to the player.
-         * 
-         * @param player Reference to the Player object to which the effect is applied.
-         * 
-         * @details 
-         * Activates the Sword effect by invoking the player's `addSwordEffect` method.
-         * This effect typically increases the player's attack damage or range, allowing for
-         * more effective combat against enemies such as the minotaur.
-         */
-        void applyEffect(Player& player) override;    
-
-        /**
-         * @brief Removes the Sword effect from the player.
-         * 
-         * @param player Reference to the Player object from which the effect is removed.
-         * 
-         * @details 
-         * Deactivates the Sword effect by invoking the player's `removeSwordEffect` method.
-         * This removes the enhanced attack capabilities, reverting the player to their normal
-         * attack state.
-         */
-        void removeEffect(Player& player) override;
-
         /**
          * @brief Constructs a Sword item with a specified position and effect duration.
          * 
@@ -54,26 +28,11 @@ class Sword : public Item
          * 
          * @details 
          * Initializes the Sword item by calling the base Item class constructor with the given
-         * position and effect duration. Sets the `takeMessage`, `removeMessage`, and `infoMessage`
-         * to provide feedback to the player when interacting with the item.
+         * position and effect duration and the kind ItemKind::SWORD; the effect and the
+         * feedback messages are selected by that kind.
          */
         Sword(Cell pos, int effectDuration = 3) 
-            : Item(pos, effectDuration) 
-        { 
-            takeMessage = "Sword effect applied."; 
-            removeMessage = "Sword effect removed."; 
-            infoMessage = "Sword effect active."; 
-        };
-
-        /**
-         * @brief Destructor for the Sword class.
-         * 
-         * @details 
-         * Currently does not perform any specific actions as there are no dynamically allocated resources.
-         * This destructor is declared as `override` to ensure proper cleanup in case the base class destructor
-         * becomes virtual in the future.
-         */
-        ~Sword() override;        
+            : Item(ItemKind::SWORD, pos, effectDuration) {};
 };
 
 #endif // SWORD_H
\ No newline at end of file
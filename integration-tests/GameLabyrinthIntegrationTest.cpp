@@ -1,5 +1,10 @@
 #include "GameLabyrinthIntegrationTest.h"
 #include <cppunit/extensions/HelperMacros.h>
+#include "bots/DistanceField.h"
+#include "bots/ItemGreedyPolicy.h"
+#include <cstdio>
+#include <fstream>
+#include <set>
 #include <thread>
 #include <chrono>
 
@@ -218,3 +223,442 @@ void GameLabyrinthIntegrationTest::testFogOfWarIntegration() {
         }
     }
 }
+
+void GameLabyrinthIntegrationTest::testMoreItemsThanFreeCells() {
+    GameConfig config;
+    config.seed = 4242u;
+    config.numItems = 100000;
+
+    // Spawning stops once every free cell holds an item instead of searching forever
+    Game game(config);
+    CPPUNIT_ASSERT(game.isReady());
+
+    const Labyrinth* map = game.getLabyrinth();
+    std::size_t freeCells = 0;
+    for (unsigned int r = 1; r + 1 < map->getHeight(); r++) {
+        for (unsigned int c = 1; c + 1 < map->getWidth(); c++) {
+            if (map->getCell(r, c).getVal() == ' ') {
+                freeCells++;
+            }
+        }
+    }
+
+    const ItemPool& items = game.getView().getItems();
+    CPPUNIT_ASSERT_EQUAL(freeCells - 2, items.size()); // All but the player's and the minotaur's cells
+
+    std::set<std::pair<int, int>> cells;
+    for (uint32_t id = 0; id < items.size(); id++) {
+        const Cell position = items[id].getPosition();
+        CPPUNIT_ASSERT_EQUAL(' ', map->getCell(position.getRow(), position.getCol()).getVal());
+        cells.insert(std::make_pair(position.getRow(), position.getCol()));
+    }
+    CPPUNIT_ASSERT_EQUAL(items.size(), cells.size());
+}
+
+void GameLabyrinthIntegrationTest::testItemsOnReachableCells() {
+    GameConfig config;
+    config.seed = 4242u;
+    config.numItems = 40;
+    config.reachableItemsOnly = true;
+
+    Game game(config);
+    CPPUNIT_ASSERT(game.isReady());
+
+    const GameView view = game.getView();
+    DistanceField fromStart;
+    fromStart.begin(view);
+    fromStart.addSource(view, view.getPlayer().getPosition().getRow(), view.getPlayer().getPosition().getCol());
+    fromStart.run(view);
+
+    CPPUNIT_ASSERT(view.getItems().size() > 0);
+    for (uint32_t id = 0; id < view.getItems().size(); id++) {
+        const Cell position = view.getItems()[id].getPosition();
+        CPPUNIT_ASSERT(fromStart.at(position.getRow(), position.getCol()) != DistanceField::UNREACHABLE);
+    }
+}
+
+void GameLabyrinthIntegrationTest::testSeveralMinotaurs() {
+    GameConfig config;
+    config.seed = 4242u;
+    config.minotaurCount = 6;
+    config.minotaurTicks = 1;
+
+    Game game(config);
+    CPPUNIT_ASSERT(game.isReady());
+
+    // Every minotaur starts on the path, and the first one is the one getMinotaur() returns
+    const MinotaurHerd& minotaurs = game.getMinotaurs();
+    const Labyrinth* map = game.getLabyrinth();
+    CPPUNIT_ASSERT_EQUAL((std::size_t)6, minotaurs.size());
+    for (uint32_t index = 0; index < minotaurs.size(); index++) {
+        bool onPath = false;
+        for (const Cell* cell : map->getPathFromEntranceToExit()) {
+            onPath = onPath || (cell->getRow() == minotaurs.getRow(index) && cell->getCol() == minotaurs.getCol(index));
+        }
+        CPPUNIT_ASSERT(onPath);
+    }
+    CPPUNIT_ASSERT(game.getMinotaur()->getPosition() == Cell(minotaurs.getRow(0), minotaurs.getCol(0), ' '));
+
+    // No item is spawned under a minotaur, and all of them move on every tick
+    const ItemPool& items = game.getView().getItems();
+    for (uint32_t id : items.lying()) {
+        const Cell position = items[id].getPosition();
+        CPPUNIT_ASSERT(!minotaurs.isOccupied(position.getRow() * map->getWidth() + position.getCol()));
+    }
+    for (int tick = 0; tick < 50 && !game.isFinished(); tick++) {
+        game.step(PlayerAction::NONE);
+        for (uint32_t index = 0; index < minotaurs.size(); index++) {
+            CPPUNIT_ASSERT(map->getCell(minotaurs.getRow(index), minotaurs.getCol(index)).getVal() == ' ');
+            CPPUNIT_ASSERT(minotaurs.isOccupied(minotaurs.getCell(index)));
+        }
+    }
+}
+
+void GameLabyrinthIntegrationTest::testShieldImmunityEndsAfterTwoTurns() {
+    // Item-greedy players pick up shields and walk into minotaurs; whenever a shield absorbs
+    // a hit, the immunity it grants must end two turns later
+    unsigned int absorbed = 0;
+    for (unsigned int seed = 1; seed <= 200 && absorbed < 10; seed++) {
+        GameConfig config;
+        config.seed = seed;
+        config.numItems = 8;
+        config.minotaurTicks = 2;
+        Game game(config);
+        if (!game.isReady()) {
+            continue;
+        }
+
+        ItemGreedyPolicy policy;
+        policy.reset(seed);
+        const Player* player = game.getPlayer();
+        uint32_t immuneUntil = 0;
+        for (int tick = 0; tick < 2000 && !game.isFinished(); tick++) {
+            const bool wasImmune = player->isImmuneToMinotaur();
+            game.step(policy.nextAction(game.getView()));
+            if (!wasImmune && player->isImmuneToMinotaur()) {
+                absorbed++;
+                immuneUntil = game.getStats().turns + 2;
+                CPPUNIT_ASSERT_EQUAL(immuneUntil, player->getExpiry(Player::EFFECT_IMMUNITY));
+                CPPUNIT_ASSERT_EQUAL(2, player->getImmuneDuration());
+            }
+            if (player->isImmuneToMinotaur()) {
+                CPPUNIT_ASSERT(game.getStats().turns < immuneUntil);
+            }
+        }
+    }
+    CPPUNIT_ASSERT(absorbed > 0);
+}
+
+void GameLabyrinthIntegrationTest::testChasingMinotaursCatchPlayer() {
+    GameConfig config;
+    config.seed = 4242u;
+    config.numItems = 0;
+    config.minotaurCount = 3;
+    config.chasingMinotaurs = true;
+    config.minotaurTicks = 1;
+
+    Game game(config);
+    CPPUNIT_ASSERT(game.isReady());
+
+    // The player waits at the entrance; every chaser gets one cell closer per move
+    const GameView view = game.getView();
+    DistanceField toPlayer;
+    toPlayer.begin(view);
+    toPlayer.addSource(view, view.getPlayer().getPosition().getRow(), view.getPlayer().getPosition().getCol());
+    toPlayer.run(view);
+
+    const MinotaurHerd& minotaurs = game.getMinotaurs();
+    uint32_t farthest = 0;
+    for (uint32_t index = 0; index < minotaurs.size(); index++) {
+        farthest = std::max(farthest, toPlayer.at(minotaurs.getRow(index), minotaurs.getCol(index)));
+    }
+    for (uint32_t tick = 0; tick < farthest && !game.isFinished(); tick++) {
+        std::vector<uint32_t> before;
+        for (uint32_t index = 0; index < minotaurs.size(); index++) {
+            before.push_back(toPlayer.at(minotaurs.getRow(index), minotaurs.getCol(index)));
+        }
+        game.step(PlayerAction::NONE);
+        for (uint32_t index = 0; index < minotaurs.size(); index++) {
+            const uint32_t after = toPlayer.at(minotaurs.getRow(index), minotaurs.getCol(index));
+            CPPUNIT_ASSERT(after == before[index] - 1 || (before[index] == 0 && after == 0));
+        }
+    }
+    CPPUNIT_ASSERT(game.getState() == Game::PLAYER_LOST);
+}
+
+void GameLabyrinthIntegrationTest::testEntitiesNeverWrittenToTerrain() {
+    GameConfig config;
+    config.seed = 4242u;
+    config.minotaurTicks = 1;
+
+    Game game(config);
+    CPPUNIT_ASSERT(game.isReady());
+
+    const Labyrinth* map = game.getLabyrinth();
+    auto snapshot = [map]() {
+        std::string cells;
+        for (unsigned int r = 0; r < map->getHeight(); r++) {
+            for (unsigned int c = 0; c < map->getWidth(); c++) {
+                cells += map->getCell(r, c).getVal();
+            }
+        }
+        return cells;
+    };
+    const std::string terrain = snapshot();
+
+    // Entities are drawn on top of the terrain, never stored in it
+    CPPUNIT_ASSERT(terrain.find_first_of("RMP") == std::string::npos);
+    const Cell start = game.getPlayer()->getPosition();
+    CPPUNIT_ASSERT_EQUAL('R', game.symbolAt(start.getRow(), start.getCol()));
+    CPPUNIT_ASSERT_EQUAL(' ', map->getCell(start.getRow(), start.getCol()).getVal());
+
+    const PlayerAction moves[] = { PlayerAction::DOWN, PlayerAction::RIGHT, PlayerAction::DOWN, PlayerAction::LEFT };
+    for (unsigned int i = 0; i < 200 && !game.isFinished(); i++) {
+        game.step(moves[i % 4]);
+        CPPUNIT_ASSERT(snapshot() == terrain);
+
+        const Cell player = game.getPlayer()->getPosition();
+        const Cell minotaur = game.getMinotaur()->getPosition();
+        CPPUNIT_ASSERT(game.symbolAt(player.getRow(), player.getCol()) == 'R' || game.isFinished());
+        if (game.getMinotaur()->isAlive() && !(player == minotaur)) {
+            CPPUNIT_ASSERT_EQUAL('M', game.symbolAt(minotaur.getRow(), minotaur.getCol()));
+        }
+    }
+}
+
+void GameLabyrinthIntegrationTest::testSeededHeadlessGameIsDeterministic() {
+    // Two games with the same seed and the same actions must play out identically
+    GameConfig config;
+    config.seed = 2024u;
+    config.numItems = 4;
+    config.minotaurTicks = 3;
+
+    Game first(config);
+    Game second(config);
+    CPPUNIT_ASSERT_EQUAL(first.isReady(), second.isReady());
+    CPPUNIT_ASSERT_EQUAL(2024u, first.getSeed());
+    CPPUNIT_ASSERT(first.isReady());
+
+    const PlayerAction actions[] = { PlayerAction::DOWN, PlayerAction::RIGHT, PlayerAction::DOWN,
+                                     PlayerAction::LEFT, PlayerAction::UP, PlayerAction::ATTACK };
+    for (unsigned int i = 0; i < 300 && !first.isFinished(); i++) {
+        first.step(actions[(i * 7 + i / 5) % 6]);
+        second.step(actions[(i * 7 + i / 5) % 6]);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(first.getState()), static_cast<int>(second.getState()));
+    CPPUNIT_ASSERT_EQUAL(first.getTick(), second.getTick());
+    CPPUNIT_ASSERT_EQUAL(first.getStats().turns, second.getStats().turns);
+    CPPUNIT_ASSERT(first.getPlayer()->getPosition() == second.getPlayer()->getPosition());
+    CPPUNIT_ASSERT(first.getMinotaur()->getPosition() == second.getMinotaur()->getPosition());
+    for (unsigned int r = 0; r < first.getLabyrinth()->getHeight(); r++) {
+        for (unsigned int c = 0; c < first.getLabyrinth()->getWidth(); c++) {
+            CPPUNIT_ASSERT_EQUAL(first.symbolAt(r, c), second.symbolAt(r, c));
+        }
+    }
+
+    // Finished games ignore further steps
+    if (first.isFinished()) {
+        uint32_t tick = first.getTick();
+        first.step(PlayerAction::UP);
+        CPPUNIT_ASSERT_EQUAL(tick, first.getTick());
+    }
+}
+
+void GameLabyrinthIntegrationTest::testPacedGameMatchesUnpaced() {
+    // The simulation clock only decides when a tick runs: a game played at real time, then
+    // at 10,000x, ends exactly like one advanced as fast as possible
+    GameConfig config;
+    config.seed = 2024u;
+    config.numItems = 4;
+
+    Game paced(config);
+    Game unpaced(config);
+    CPPUNIT_ASSERT(paced.isReady());
+
+    const PlayerAction actions[] = { PlayerAction::DOWN, PlayerAction::RIGHT, PlayerAction::DOWN,
+                                     PlayerAction::LEFT, PlayerAction::UP, PlayerAction::ATTACK };
+    const unsigned int realTimeTicks = SimClock::TICKS_PER_SECOND + 4;
+    SimClock realTime(1.0);
+    SimClock fast(10000.0);
+    SimClock asFastAsPossible(0.0);
+    realTime.start();
+    for (unsigned int i = 0; i < 400; i++) {
+        if (i == realTimeTicks) {
+            fast.start();
+        }
+        if (i < realTimeTicks) {
+            realTime.waitForTick(i);
+        } else {
+            fast.waitForTick(i - realTimeTicks);
+        }
+        paced.step(actions[(i * 7 + i / 5) % 6]);
+
+        asFastAsPossible.waitForTick(i);
+        unpaced.step(actions[(i * 7 + i / 5) % 6]);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(unpaced.getState()), static_cast<int>(paced.getState()));
+    CPPUNIT_ASSERT_EQUAL(unpaced.getTick(), paced.getTick());
+    CPPUNIT_ASSERT_EQUAL(unpaced.getStats().turns, paced.getStats().turns);
+    CPPUNIT_ASSERT_EQUAL(unpaced.getStats().itemsDestroyed, paced.getStats().itemsDestroyed);
+    CPPUNIT_ASSERT(unpaced.getMinotaur()->getPosition() == paced.getMinotaur()->getPosition());
+    for (unsigned int r = 0; r < paced.getLabyrinth()->getHeight(); r++) {
+        for (unsigned int c = 0; c < paced.getLabyrinth()->getWidth(); c++) {
+            CPPUNIT_ASSERT_EQUAL(unpaced.symbolAt(r, c), paced.symbolAt(r, c));
+        }
+    }
+}
+
+void GameLabyrinthIntegrationTest::testReplayRebuildsGame() {
+    // A game on a labyrinth generated with another seed is recorded, then rebuilt from the
+    // replay alone and played back, as fast as possible and at 10,000x
+    GameConfig mapConfig;
+    mapConfig.seed = 2024u;
+    Game mapOwner(mapConfig);
+    CPPUNIT_ASSERT(mapOwner.isReady());
+
+    GameConfig config;
+    config.seed = 99u;
+    config.numItems = 5;
+    config.minotaurTicks = 4;
+    config.minotaurCount = 2;
+    config.replayFile = "integration_replay.replay";
+    Game recorded(mapOwner.getSharedLabyrinth(), config);
+    CPPUNIT_ASSERT(recorded.isReady());
+
+    const PlayerAction actions[] = { PlayerAction::DOWN, PlayerAction::RIGHT, PlayerAction::NONE, PlayerAction::DOWN,
+                                     PlayerAction::LEFT, PlayerAction::UP, PlayerAction::ATTACK, PlayerAction::NONE };
+    for (unsigned int i = 0; i < 500 && !recorded.isFinished(); i++) {
+        recorded.step(actions[(i * 7 + i / 5) % 8]);
+    }
+    recorded.step(PlayerAction::QUIT);
+    CPPUNIT_ASSERT(recorded.isFinished());
+
+    for (double speed : { 0.0, 10000.0 }) {
+        ReplayReader reader(config.replayFile);
+        CPPUNIT_ASSERT(reader.isValid());
+        CPPUNIT_ASSERT_EQUAL(2024u, reader.getHeader().labyrinthSeed);
+        CPPUNIT_ASSERT_EQUAL(99u, reader.getHeader().seed);
+
+        Game replayed(reader.getHeader());
+        CPPUNIT_ASSERT(replayed.isReady());
+        CPPUNIT_ASSERT(replayed.playReplay(reader, speed));
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(recorded.getState()), static_cast<int>(replayed.getState()));
+        CPPUNIT_ASSERT_EQUAL(recorded.getTick(), replayed.getTick());
+        CPPUNIT_ASSERT_EQUAL(recorded.getStats().turns, replayed.getStats().turns);
+        CPPUNIT_ASSERT_EQUAL(recorded.getStats().itemsDestroyed, replayed.getStats().itemsDestroyed);
+        for (unsigned int r = 0; r < recorded.getLabyrinth()->getHeight(); r++) {
+            for (unsigned int c = 0; c < recorded.getLabyrinth()->getWidth(); c++) {
+                CPPUNIT_ASSERT_EQUAL(recorded.symbolAt(r, c), replayed.symbolAt(r, c));
+            }
+        }
+    }
+}
+
+void GameLabyrinthIntegrationTest::testInteractiveGameRecordsOnlyWhenAsked() {
+    // Without a GameRecording an interactive game leaves no event log or replay behind
+    std::remove("game.events");
+    std::remove("game.replay");
+    {
+        Game silent(21, 21, 1, false, true, false);
+    }
+    CPPUNIT_ASSERT(!std::ifstream("game.events").good());
+    CPPUNIT_ASSERT(!std::ifstream("game.replay").good());
+
+    // Named files are written
+    const GameRecording recording{ "integration_interactive.events", "integration_interactive.replay" };
+    bool ready;
+    {
+        Game recorded(21, 21, 1, false, true, false, recording);
+        ready = recorded.isReady();
+    }
+    CPPUNIT_ASSERT(std::ifstream(recording.eventLogFile).good());
+    if (ready) {
+        CPPUNIT_ASSERT(ReplayReader(recording.replayFile).isValid());
+    }
+    std::remove(recording.eventLogFile.c_str());
+    std::remove(recording.replayFile.c_str());
+}
+
+void GameLabyrinthIntegrationTest::testEventLogIgnoresTextLogLevel() {
+    // An event log without a text log still records every spawn and every move
+    GameConfig config;
+    config.seed = 5u;
+    config.numItems = 4;
+    config.minotaurTicks = 3;
+    config.eventLogFile = "integration_levels.events";
+    GameStats stats;
+    {
+        Game game(config);
+        CPPUNIT_ASSERT(game.isReady());
+        const PlayerAction actions[] = { PlayerAction::DOWN, PlayerAction::RIGHT, PlayerAction::DOWN,
+                                         PlayerAction::LEFT, PlayerAction::UP };
+        for (unsigned int i = 0; i < 300 && !game.isFinished(); i++) {
+            game.step(actions[(i * 7 + i / 5) % 5]);
+        }
+        stats = game.getStats();
+    }
+
+    std::ifstream in(config.eventLogFile, std::ios::binary);
+    CPPUNIT_ASSERT(EventLog::readHeader(in));
+    uint32_t counts[256] = {};
+    GameEvent event;
+    while (in.read(reinterpret_cast<char*>(&event), sizeof(event))) {
+        counts[event.type]++;
+    }
+    in.close();
+    std::remove(config.eventLogFile.c_str());
+
+    CPPUNIT_ASSERT_EQUAL(1u, counts[static_cast<uint8_t>(GameEventType::PLAYER_SPAWNED)]);
+    CPPUNIT_ASSERT_EQUAL(1u, counts[static_cast<uint8_t>(GameEventType::MINOTAUR_SPAWNED)]);
+    CPPUNIT_ASSERT_EQUAL(4u, counts[static_cast<uint8_t>(GameEventType::ITEM_SPAWNED)]);
+    CPPUNIT_ASSERT(stats.turns > 0);
+    CPPUNIT_ASSERT_EQUAL(stats.turns, counts[static_cast<uint8_t>(GameEventType::PLAYER_MOVED)]);
+    CPPUNIT_ASSERT(counts[static_cast<uint8_t>(GameEventType::MINOTAUR_MOVED)] > 0);
+}
+
+void GameLabyrinthIntegrationTest::testGamesShareOneLabyrinth() {
+    std::shared_ptr<const Labyrinth> map = std::make_shared<const Labyrinth>(21, 21, true, 77u);
+    CPPUNIT_ASSERT(map->getMapGenerationSuccess());
+    std::string terrain;
+    for (unsigned int r = 0; r < map->getHeight(); r++) {
+        for (unsigned int c = 0; c < map->getWidth(); c++) {
+            terrain += map->getCell(r, c).getVal();
+        }
+    }
+
+    GameConfig config;
+    config.minotaurTicks = 2;
+    config.seed = 11u;
+    Game first(map, config);
+    Game replay(map, config);
+    config.seed = 12u;
+    Game other(map, config);
+    CPPUNIT_ASSERT(first.isReady());
+
+    // One grid for all games, no copies
+    CPPUNIT_ASSERT(first.getLabyrinth() == map.get());
+    CPPUNIT_ASSERT(other.getSharedLabyrinth() == map);
+    CPPUNIT_ASSERT_EQUAL(4L, static_cast<long>(map.use_count()));
+
+    const PlayerAction actions[] = { PlayerAction::DOWN, PlayerAction::RIGHT, PlayerAction::DOWN,
+                                     PlayerAction::LEFT, PlayerAction::ATTACK };
+    for (unsigned int i = 0; i < 200; i++) {
+        first.step(actions[(i * 3 + i / 7) % 5]);
+        replay.step(actions[(i * 3 + i / 7) % 5]);
+        other.step(actions[(i * 5 + i / 3) % 5]);
+    }
+
+    // Games on the same map with the same seed play out identically, and none writes the map
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(first.getState()), static_cast<int>(replay.getState()));
+    CPPUNIT_ASSERT(first.getPlayer()->getPosition() == replay.getPlayer()->getPosition());
+    CPPUNIT_ASSERT(first.getMinotaur()->getPosition() == replay.getMinotaur()->getPosition());
+    std::string after;
+    for (unsigned int r = 0; r < map->getHeight(); r++) {
+        for (unsigned int c = 0; c < map->getWidth(); c++) {
+            after += map->getCell(r, c).getVal();
+        }
+    }
+    CPPUNIT_ASSERT(after == terrain);
+}
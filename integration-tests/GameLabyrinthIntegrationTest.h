@@ -24,10 +24,15 @@ class GameLabyrinthIntegrationTest : public CPPUNIT_NS::TestFixture {
     // Player and minotaur positioning
     CPPUNIT_TEST(testPlayerSpawnAtLabyrinthEntrance);
     CPPUNIT_TEST(testMinotaurSpawnOnValidPath);
+    CPPUNIT_TEST(testSeveralMinotaurs);
+    CPPUNIT_TEST(testShieldImmunityEndsAfterTwoTurns);
+    CPPUNIT_TEST(testChasingMinotaursCatchPlayer);
     
     // Item placement integration
     CPPUNIT_TEST(testItemsPlacedOnValidCells);
     CPPUNIT_TEST(testItemsNotPlacedOnWalls);
+    CPPUNIT_TEST(testMoreItemsThanFreeCells);
+    CPPUNIT_TEST(testItemsOnReachableCells);
     
     // Game state and labyrinth interaction
     CPPUNIT_TEST(testGameStateWithValidPath);
@@ -36,6 +41,15 @@ class GameLabyrinthIntegrationTest : public CPPUNIT_NS::TestFixture {
     // Map rendering and game objects
     CPPUNIT_TEST(testMapRenderingWithGameObjects);
     CPPUNIT_TEST(testFogOfWarIntegration);
+    CPPUNIT_TEST(testEntitiesNeverWrittenToTerrain);
+
+    // Headless seeded games
+    CPPUNIT_TEST(testSeededHeadlessGameIsDeterministic);
+    CPPUNIT_TEST(testPacedGameMatchesUnpaced);
+    CPPUNIT_TEST(testReplayRebuildsGame);
+    CPPUNIT_TEST(testInteractiveGameRecordsOnlyWhenAsked);
+    CPPUNIT_TEST(testEventLogIgnoresTextLogLevel);
+    CPPUNIT_TEST(testGamesShareOneLabyrinth);
     
     CPPUNIT_TEST_SUITE_END();
 
@@ -52,12 +66,24 @@ public:
     void testGameInitializationWithDifferentSizes();
     void testPlayerSpawnAtLabyrinthEntrance();
     void testMinotaurSpawnOnValidPath();
+    void testSeveralMinotaurs();
+    void testShieldImmunityEndsAfterTwoTurns();
+    void testChasingMinotaursCatchPlayer();
     void testItemsPlacedOnValidCells();
     void testItemsNotPlacedOnWalls();
+    void testMoreItemsThanFreeCells();
+    void testItemsOnReachableCells();
     void testGameStateWithValidPath();
     void testPlayerMovementInLabyrinth();
     void testMapRenderingWithGameObjects();
     void testFogOfWarIntegration();
+    void testEntitiesNeverWrittenToTerrain();
+    void testSeededHeadlessGameIsDeterministic();
+    void testPacedGameMatchesUnpaced();
+    void testReplayRebuildsGame();
+    void testInteractiveGameRecordsOnlyWhenAsked();
+    void testEventLogIgnoresTextLogLevel();
+    void testGamesShareOneLabyrinth();
 };
 
 #endif // GAME_LABYRINTH_INTEGRATION_TEST_H
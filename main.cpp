@@ -7,7 +7,38 @@
 //
 
 #include "Game.h"
+#include "Replay.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
+
+/**
+ * @brief Plays a game recorded in a replay file (game.replay) again.
+ * 
+ * @param filename Path of the replay.
+ * @param speed Speed-up over real time; 0 plays without rendering, as fast as possible.
+ * @return int 0 if the game was played back to its recorded end, otherwise 1.
+ */
+static int playReplay(const char* filename, double speed) {
+    ReplayReader replay(filename);
+    if (!replay.isValid()) {
+        std::cout << "Not a replay file: " << filename << "\n";
+        return 1;
+    }
+
+    Game game(replay.getHeader());
+    if (!game.isReady()) {
+        std::cout << "The labyrinth of the replay cannot be rebuilt.\n";
+        return 1;
+    }
+
+    static const char* const STATE_NAMES[] = { "PLAYING", "PLAYER_WON", "PLAYER_LOST", "QUIT" };
+    const bool complete = game.playReplay(replay, speed, speed > 0.0);
+    std::cout << "Replayed " << game.getTick() << " ticks: " << STATE_NAMES[game.getState()]
+              << (complete ? "" : " (does not match the recording)") << "\n";
+    return complete ? 0 : 1;
+}
 
 /**
  * @brief The main entry point of the Labyrinth Robot game.
@@ -15,12 +46,34 @@
  * @details 
  * This function prompts the user to input the dimensions of the labyrinth and the number of special items.
  * It validates the input and initializes the Game object, which starts the game.
+ * If a labyrinth file saved with Labyrinth::saveToFile() is passed as the first argument,
+ * it is loaded instead of generating a new map and only the number of items is asked.
+ * With --replay, a recorded game.replay is played back instead.
  * 
  * @return int Returns 0 if the game initializes successfully, otherwise returns 1.
  */
-int main() {
+int main(int argc, char** argv) {
     unsigned int width, height, numItems;
 
+    // Play a recording back: ./labyrinth-game --replay <file> [speed], speed 0 = headless
+    if (argc > 2 && std::strcmp(argv[1], "--replay") == 0) {
+        return playReplay(argv[2], argc > 3 ? std::atof(argv[3]) : 1.0);
+    }
+
+    // Play on a saved labyrinth: ./labyrinth-game <labyrinth-file>
+    if (argc > 1) {
+        std::cout << "Enter number of items: ";
+        std::cin >> numItems;
+
+        if (numItems < 4) {
+            std::cout << "Number of items must be at least 4.\n";
+            return 1;
+        }
+
+        Game game(std::string(argv[1]), numItems, true, GameRecording{"game.events", "game.replay"});
+        return 0;
+    }
+
     // Prompt the user for labyrinth dimensions and number of items
     std::cout << "Enter width of labyrinth: ";
     std::cin >> width;
@@ -48,7 +101,7 @@ int main() {
      * Creates a Game object with the specified dimensions and number of items.
      * The Game constructor handles the game loop and gameplay mechanics.
      */
-    Game game(width, height, numItems);
+    Game game(width, height, numItems, true, GameRecording{"game.events", "game.replay"});
 
     return 0; // Exit successfully
 }
\ No newline at end of file
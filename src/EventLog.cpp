@@ -0,0 +1,88 @@
+#include "EventLog.h"
+#include <cstring>
+#include <iostream>
+
+/**
+ * @brief Creates the event log file and writes its header.
+ *
+ * @param filename Path of the file to create. An empty name disables the log.
+ *
+ * @details The record buffer is reserved up front so recording never allocates.
+ */
+EventLog::EventLog(const std::string& filename)
+{
+    if (filename.empty()) {
+        return;
+    }
+
+    file.open(filename, std::ios::out | std::ios::binary);
+    if (!file) {
+        std::cerr << "Error: Unable to open event log file: " << filename << std::endl;
+        return;
+    }
+
+    EventLogHeader header;
+    std::memcpy(header.magic, "LBEV", 4);
+    header.version = VERSION;
+    header.recordSize = sizeof(GameEvent);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    buffer.reserve(BUFFER_RECORDS);
+}
+
+/**
+ * @brief Writes the buffered records and closes the file.
+ */
+EventLog::~EventLog()
+{
+    if (file.is_open()) {
+        flush();
+        file.close();
+    }
+}
+
+/**
+ * @brief Writes all buffered records to the file with a single write.
+ */
+void EventLog::flush()
+{
+    if (!file.is_open() || buffer.empty()) {
+        return;
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size() * sizeof(GameEvent)));
+    file.flush();
+    buffer.clear();
+}
+
+const char* EventLog::typeName(uint8_t type)
+{
+    static const char* const NAMES[] = {
+        "PLAYER_SPAWNED",
+        "MINOTAUR_SPAWNED",
+        "ITEM_SPAWNED",
+        "PLAYER_MOVED",
+        "MINOTAUR_MOVED",
+        "ITEM_ACTIVATED",
+        "ITEM_EXPIRED",
+        "ITEM_DESTROYED",
+        "MINOTAUR_KILLED",
+        "ATTACK_MISSED",
+        "STATE_CHANGED"
+    };
+    if (type < sizeof(NAMES) / sizeof(NAMES[0])) {
+        return NAMES[type];
+    }
+    return "UNKNOWN";
+}
+
+bool EventLog::readHeader(std::istream& in)
+{
+    EventLogHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return false;
+    }
+    return std::memcmp(header.magic, "LBEV", 4) == 0 &&
+           header.version == VERSION &&
+           header.recordSize == sizeof(GameEvent);
+}
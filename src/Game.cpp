@@ -11,12 +11,39 @@
 #include "items/Hummer.h"
 #include "items/Shield.h"
 #include "items/Sword.h"
+#include "Trace.h"
+#include "bots/DistanceField.h"
+#include <algorithm>
 #include <ctime>
 #include <cstdlib>
 #include <iostream>
-#include <thread>
 #include <chrono>
 
+// The game log is written on every step, so it goes through the background writer:
+// the game loop only copies the message into the logger's ring and never waits for the disk.
+// The runtime level defaults to INFO and can be changed with LABYRINTH_LOG_LEVEL
+// (trace, debug, info, warn, off); per-step movement is only recorded at trace level.
+static LoggerOptions gameLoggerOptions()
+{
+    LoggerOptions options;
+    options.async = true;
+    options.flushPolicy = FlushPolicy::ON_INTERVAL;
+    options.flushInterval = std::chrono::milliseconds(250);
+
+    const char* level = std::getenv("LABYRINTH_LOG_LEVEL");
+    options.level = level ? Logger::parseLevel(level, LogLevel::INFO) : LogLevel::INFO;
+    return options;
+}
+
+// Colors of the effect lines below the map, indexed by Player::Effect
+static std::ostream& (* const EFFECT_COLORS[Player::EFFECT_COUNT])(std::ostream&) = {
+    termcolor::on_bright_grey<char>,    // Fog of war
+    termcolor::bright_yellow<char>,     // Hummer
+    termcolor::on_bright_green<char>,   // Shield
+    termcolor::on_bright_red<char>,     // Sword
+    termcolor::on_yellow<char>          // Immunity
+};
+
 /**
  * @brief Constructs a Game object with specified dimensions and number of items.
  * 
@@ -24,17 +51,20 @@
  * @param height The height of the labyrinth.
  * @param numItems The number of items to spawn in the labyrinth.
  * @param startGame Whether to automatically start the game loop (default: true for backward compatibility).
+ * @param recording Event log and replay files; empty paths (the default) record nothing.
  * 
  * @details 
  * Initializes the game by setting up the labyrinth, spawning entities. If startGame is true, starts the game loop.
  */
-Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame)
-    : logger("game.log"), state(GAME_STATE::PLAYING), numItems(numItems), labyrinth(nullptr), player(nullptr), minotaur(nullptr)
+Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame,
+           const GameRecording& recording)
+    : logger("game.log", gameLoggerOptions()), events(recording.eventLogFile), state(GAME_STATE::PLAYING), numItems(numItems), player(nullptr), minotaur(nullptr)
 {
-    logger.log("Game constructor started");  // Test log entry
+    LOG_DEBUG(logger, "Game constructor started");  // Test log entry
     init(width, height, false, true);   // Initialize with quiet mode disabled and exit on failure enabled
-    spawn();                            // Spawn player, minotaur, and items
-    labyrinth->print();                 // Display the initial state of the labyrinth
+    ready = spawn();                    // Spawn player, minotaur, and items
+    startReplay(recording.replayFile, "");  // Record the actions to play the game again
+    labyrinth->print(composeFrame());   // Display the initial state of the labyrinth
     
     if (startGame) {
         updateGameState();              // Start the game loop only if requested
@@ -49,17 +79,20 @@ Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool
  * @param numItems The number of items to spawn in the labyrinth.
  * @param startGame Whether to automatically start the game loop.
  * @param quiet Whether to enable quiet mode for the labyrinth.
+ * @param recording Event log and replay files; empty paths (the default) record nothing.
  * 
  * @details 
  * Initializes the game by setting up the labyrinth with quiet mode, spawning entities. If startGame is true, starts the game loop.
  */
-Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet)
-    : logger("game.log"), state(GAME_STATE::PLAYING), numItems(numItems), labyrinth(nullptr), player(nullptr), minotaur(nullptr)
+Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet,
+           const GameRecording& recording)
+    : logger("game.log", gameLoggerOptions()), events(recording.eventLogFile), state(GAME_STATE::PLAYING), numItems(numItems), player(nullptr), minotaur(nullptr)
 {
     init(width, height, quiet, true); // Initialize with exit on failure enabled for backward compatibility
-    spawn();                          // Spawn player, minotaur, and items
+    ready = spawn();                  // Spawn player, minotaur, and items
+    startReplay(recording.replayFile, ""); // Record the actions to play the game again
     if (!quiet) {
-        labyrinth->print();           // Display the initial state only if not in quiet mode
+        labyrinth->print(composeFrame()); // Display the initial state only if not in quiet mode
     }
     
     if (startGame) {
@@ -76,20 +109,22 @@ Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool
  * @param startGame Whether to automatically start the game loop.
  * @param quiet Whether to enable quiet mode for the labyrinth.
  * @param exitOnFailure Whether to exit on map generation failure.
+ * @param recording Event log and replay files; empty paths (the default) record nothing.
  * 
  * @details 
  * Initializes the game by setting up the labyrinth with quiet mode and exit behavior control, spawning entities. If startGame is true, starts the game loop.
  */
-Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet, bool exitOnFailure)
-    : logger("game.log"), state(GAME_STATE::PLAYING), numItems(numItems), labyrinth(nullptr), player(nullptr), minotaur(nullptr)
+Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool startGame, bool quiet, bool exitOnFailure,
+           const GameRecording& recording)
+    : logger("game.log", gameLoggerOptions()), events(recording.eventLogFile), state(GAME_STATE::PLAYING), numItems(numItems), player(nullptr), minotaur(nullptr)
 {
     init(width, height, quiet, exitOnFailure); // Initialize with exit behavior control
     
     // Only spawn entities and start game if map generation was successful
-    if (labyrinth && labyrinth->getMapGenerationSuccess()) {
-        spawn();                    // Spawn player, minotaur, and items
+    if (labyrinth && labyrinth->getMapGenerationSuccess() && (ready = spawn())) {
+        startReplay(recording.replayFile, ""); // Record the actions to play the game again
         if (!quiet) {
-            labyrinth->print();     // Display the initial state only if not in quiet mode
+            labyrinth->print(composeFrame()); // Display the initial state only if not in quiet mode
         }
         
         if (startGame) {
@@ -98,6 +133,152 @@ Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool
     }
 }
 
+/**
+ * @brief Constructs a Game object on a labyrinth loaded from a file.
+ * 
+ * @param labyrinthFile Path of a labyrinth saved with Labyrinth::saveToFile().
+ * @param numItems The number of items to spawn in the labyrinth.
+ * @param startGame Whether to automatically start the game loop.
+ * @param recording Event log and replay files; empty paths (the default) record nothing.
+ * 
+ * @details 
+ * Skips generation entirely: the saved map is loaded, entities are spawned and, if startGame is true, the game loop starts.
+ */
+Game::Game(const std::string& labyrinthFile, unsigned int numItems, bool startGame,
+           const GameRecording& recording)
+    : logger("game.log", gameLoggerOptions()), events(recording.eventLogFile), state(GAME_STATE::PLAYING), numItems(numItems), player(nullptr), minotaur(nullptr)
+{
+    LOG_INFO(logger, "Game init from labyrinth file: " + labyrinthFile);
+    init(std::make_shared<const Labyrinth>(labyrinthFile, false), false, true);
+    ready = spawn();
+    startReplay(recording.replayFile, labyrinthFile);
+    labyrinth->print(composeFrame());
+
+    if (startGame) {
+        updateGameState();
+    }
+}
+
+/**
+ * @brief Constructs a headless game from a configuration.
+ * 
+ * @param config Dimensions, items, seed and log files of the game.
+ * 
+ * @details 
+ * The labyrinth and the game share one seed, so the same configuration always produces
+ * the same map, the same spawn positions and, given the same actions, the same game.
+ * Neither the constructor nor step() write to the terminal or exit the program.
+ */
+Game::Game(const GameConfig& config)
+    : player(nullptr), minotaur(nullptr), numItems(config.numItems),
+      logger(config.logFile, gameLoggerOptions()), events(config.eventLogFile), seed(config.seed ? config.seed : std::random_device{}()),
+      state(GAME_STATE::PLAYING)
+{
+    initHeadless(std::make_shared<const Labyrinth>(config.width, config.height, config.quiet, seed), config);
+}
+
+/**
+ * @brief Constructs a headless game on a labyrinth shared with other games.
+ * 
+ * @param labyrinth The shared labyrinth; it is only read.
+ * @param config Items, seed, minotaur speed and log files of the game; the dimensions are ignored.
+ * 
+ * @details 
+ * The game keeps a reference to the labyrinth instead of a copy, so its own memory is limited
+ * to the entities, the walls it broke and the loggers. The seed only drives the spawn positions
+ * and the minotaur.
+ */
+Game::Game(std::shared_ptr<const Labyrinth> labyrinth, const GameConfig& config)
+    : player(nullptr), minotaur(nullptr), numItems(config.numItems),
+      logger(config.logFile, gameLoggerOptions()), events(config.eventLogFile), seed(config.seed ? config.seed : std::random_device{}()),
+      state(GAME_STATE::PLAYING)
+{
+    initHeadless(std::move(labyrinth), config);
+}
+
+/**
+ * @brief Common part of the headless constructors.
+ * 
+ * @param labyrinth The labyrinth to play on; a null handle leaves the game not ready.
+ * @param config Configuration of the game.
+ */
+void Game::initHeadless(std::shared_ptr<const Labyrinth> labyrinth, const GameConfig& config)
+{
+    // The event log records every event on its own; the level only filters the text log
+    if (config.logFile.empty()) {
+        logger.setLevel(LogLevel::OFF);
+    }
+    minotaurTicks = config.minotaurTicks > 0 ? config.minotaurTicks : 1;
+    reachableItemsOnly = config.reachableItemsOnly;
+    minotaurCount = config.minotaurCount;
+    chasingMinotaurs = config.chasingMinotaurs;
+
+    if (!labyrinth) {
+        return;
+    }
+    init(std::move(labyrinth), config.quiet, false);
+    if (this->labyrinth->getMapGenerationSuccess()) {
+        ready = spawn();
+    }
+    if (ready) {
+        startReplay(config.replayFile, "");
+    }
+}
+
+/**
+ * @brief Constructs a headless game with the parameters of a recorded one.
+ * 
+ * @param header Header of a replay.
+ */
+Game::Game(const ReplayHeader& header)
+    : player(nullptr), minotaur(nullptr), numItems(header.numItems),
+      logger("", gameLoggerOptions()), events(""), seed(header.seed),
+      state(GAME_STATE::PLAYING)
+{
+    GameConfig config;
+    config.width = header.width;
+    config.height = header.height;
+    config.numItems = header.numItems;
+    config.seed = header.seed;
+    config.minotaurTicks = header.minotaurTicks;
+    config.minotaurCount = header.minotaurCount;
+    config.chasingMinotaurs = header.chasingMinotaurs;
+    config.reachableItemsOnly = header.reachableItemsOnly;
+
+    std::shared_ptr<const Labyrinth> map = header.labyrinthFile.empty()
+        ? std::make_shared<const Labyrinth>(header.width, header.height, true, header.labyrinthSeed)
+        : std::make_shared<const Labyrinth>(header.labyrinthFile, true);
+    initHeadless(std::move(map), config);
+}
+
+/**
+ * @brief Starts recording the game into a replay file.
+ * 
+ * @param filename Path of the replay; an empty name records nothing.
+ * @param labyrinthFile File the labyrinth was loaded from, empty if it was generated.
+ */
+void Game::startReplay(const std::string& filename, const std::string& labyrinthFile)
+{
+    if (filename.empty() || !ready) {
+        return;
+    }
+
+    ReplayHeader header;
+    header.width = labyrinth->getWidth();
+    header.height = labyrinth->getHeight();
+    header.labyrinthSeed = labyrinth->getSeed();
+    header.seed = seed;
+    header.numItems = static_cast<uint32_t>(numItems);
+    header.minotaurTicks = minotaurTicks;
+    header.minotaurCount = minotaurCount;
+    header.chasingMinotaurs = chasingMinotaurs;
+    header.reachableItemsOnly = reachableItemsOnly;
+    header.labyrinthFile = labyrinthFile;
+    if (!replay.open(filename, header)) {
+        LOG_WARN(logger, "Unable to write replay " + filename);
+    }
+}
+
 // Initializes the labyrinth, player, minotaur, and item list
 /**
  * @brief Initializes the game components including the labyrinth, player, minotaur, and items.
@@ -111,35 +292,77 @@ Game::Game(unsigned int width, unsigned int height, unsigned int numItems, bool
 void Game::init(unsigned int width, unsigned int height, bool quiet, bool exitOnFailure)
 {
 
-    logger.log("Game init with width: " + std::to_string(width) + " and height: " + std::to_string(height));
+    LOG_INFO(logger, "Game init with width: " + std::to_string(width) + " and height: " + std::to_string(height));
 
-    // Dynamically allocate the labyrinth
-    labyrinth = new Labyrinth(width, height, quiet);
+    // Generate the labyrinth; nothing else references it, but it is held like a shared one
+    init(std::make_shared<const Labyrinth>(width, height, quiet, seed), quiet, exitOnFailure);
+}
+
+/**
+ * @brief Initializes the game around an already created labyrinth.
+ * 
+ * @param labyrinth The generated or loaded labyrinth; the game keeps a reference and only reads it.
+ * @param quiet Whether to suppress console output.
+ * @param exitOnFailure Whether to exit the program if the labyrinth is not usable.
+ * 
+ * @details 
+ * Checks that the labyrinth is valid and initializes the player and minotaur entities.
+ */
+void Game::init(std::shared_ptr<const Labyrinth> labyrinth, bool quiet, bool exitOnFailure)
+{
+    this->labyrinth = labyrinth;
+    this->exitOnFailure = exitOnFailure;
 
     // Check if labyrinth generation was successful
     if (!labyrinth->getMapGenerationSuccess()) {
         if (!quiet) {
             std::cout << "Try again.\n";
         }
-        logger.log("Map generation failed. Exiting...");
+        LOG_WARN(logger, "Map generation failed. Exiting...");
         if (exitOnFailure) {
+            logger.flush(); // exit() skips destructors, push the queued records out first
+            events.flush();
             exit(1);
         } else {
             // For test environments, don't exit but return without initializing entities
             return;
         }
     }
-    logger.log("Map generated successfully.");
-    logger.log("Time taken to generate the labyrinth: " + std::to_string(labyrinth->getGenerationTime()) + " ms");
+    LOG_INFO(logger, "Map generated successfully.");
+    LOG_INFO(logger, "Time taken to generate the labyrinth: " + std::to_string(labyrinth->getGenerationTime()) + " ms");
+    LOG_INFO(logger, "Labyrinth size: " + std::to_string(labyrinth->getWidth()) + " x " + std::to_string(labyrinth->getHeight()));
+
+    // Loaded labyrinths have no generation to report
+    const GenerationStats& stats = labyrinth->getGenerationStats();
+    if (stats.attempts > 0) {
+        LOG_INFO(logger, "Generation attempts: " + std::to_string(stats.attempts) +
+                         " (no path: " + std::to_string(stats.noPathFailures) +
+                         ", too few walls: " + std::to_string(stats.wallConditionFailures) + ")");
+        LOG_INFO(logger, "Generation phases (ns): reset " + std::to_string(stats.resetNs) +
+                         ", eller " + std::to_string(stats.ellerNs) +
+                         ", semicircle " + std::to_string(stats.semicircleNs) +
+                         ", path check " + std::to_string(stats.pathCheckNs) +
+                         ", wall condition " + std::to_string(stats.wallConditionNs) +
+                         ", find path " + std::to_string(stats.findPathNs) +
+                         ", total " + std::to_string(stats.totalNs));
+        LOG_INFO(logger, "Generation BFS cells visited: " + std::to_string(stats.bfsCellsVisited) +
+                         ", peak scratch memory: " + std::to_string(stats.peakScratchBytes) + " bytes");
+    }
 
     // Log start and end points of the labyrinth
-    logger.log("Start point: " + std::to_string(labyrinth->getStartPoint().getRow()) + " " + std::to_string(labyrinth->getStartPoint().getCol()));
-    logger.log("End point: " + std::to_string(labyrinth->getEndPoint().getRow()) + " " + std::to_string(labyrinth->getEndPoint().getCol()));
+    LOG_INFO(logger, "Start point: " + std::to_string(labyrinth->getStartPoint().getRow()) + " " + std::to_string(labyrinth->getStartPoint().getCol()));
+    LOG_INFO(logger, "End point: " + std::to_string(labyrinth->getEndPoint().getRow()) + " " + std::to_string(labyrinth->getEndPoint().getCol()));
 
     // Initialize game entities
-    items = std::list<Item*>();      // Initialize the items list
+    items.clear();                   // Initialize the items and their cell index
+    turnTimers.reset();
+    clockTimers.reset();
     player = new Player();           // Dynamically allocate the player
-    minotaur = new Minotaur();       // Dynamically allocate the minotaur
+    minotaurs.reset(labyrinth->getWidth());
+    minotaur = new Minotaur(&minotaurs, 0); // Handle to the first minotaur
+    if (chasingMinotaurs) {
+        chaseField.reset(new DistanceField());
+    }
 }
 
 // Spawns the player, minotaur, and randomly places items in the labyrinth
@@ -147,109 +370,156 @@ void Game::init(unsigned int width, unsigned int height, bool quiet, bool exitOn
  * @brief Spawns the player, minotaur, and items within the labyrinth.
  * 
  * @details 
- * Positions the player at the start point, places the minotaur along the generated path, and randomly distributes items ensuring they are placed on empty cells.
+ * Positions the player at the start point, places the minotaur along the generated path, and places the items on distinct empty cells chosen without replacement from the labyrinth's floor cells; if there are fewer free cells than items, only as many items as cells are spawned.
+ * All positions are drawn from the game's own generator.
  */
-void Game::spawn()
+bool Game::spawn()
 {
-    srand(static_cast<unsigned int>(time(nullptr))); // Seed the random number generator
+    TRACE_SCOPE("Game::spawn");
 
     // Lambda function to generate a random number between min and max (inclusive)
-    auto randomNumBetween = [](int min, int max) -> int {
-        return min + (rand() % (max - min + 1));
+    auto randomNumBetween = [this](int min, int max) -> int {
+        return min + static_cast<int>(rng() % static_cast<unsigned int>(max - min + 1));
     };
 
     // Spawn the Player
     Cell startPoint = labyrinth->getStartPoint();
     startPoint.setRow(startPoint.getRow() + 1); // Adjust player starting position
     player->setPosition(startPoint);
-    labyrinth->getCell(startPoint.getRow(), startPoint.getCol()).setVal('R'); // 'R' represents the player
 
-    logger.log("Player spawned at: " + std::to_string(startPoint.getRow()) + " " + std::to_string(startPoint.getCol()));
+    if (events.isOpen()) {
+        events.record(GameEventType::PLAYER_SPAWNED, tick, startPoint.getRow(), startPoint.getCol());
+    }
 
-    // Spawn the Minotaur at a random position along the path
+    // Spawn the Minotaurs at random positions along the path
+    minotaurs.reset(labyrinth->getWidth());
+    chaseFieldSource = UINT32_MAX;
     std::list<Cell*> path = labyrinth->getPathFromEntranceToExit();
     if (path.size() < 14) { // Ensure there's enough space to avoid out-of-range
-        logger.log("Path too short to spawn minotaur. Exiting...");
+        LOG_WARN(logger, "Path too short to spawn minotaur. Exiting...");
+        if (!exitOnFailure) {
+            return false;
+        }
+        logger.flush();
+        events.flush();
         exit(1);
     }
-    int rndPos = randomNumBetween(7, static_cast<int>(path.size()) - 7); // Avoid spawning too close to start/end
-    auto it = path.begin();
-    std::advance(it, rndPos);
-    Cell* minotaurPos = *it;
-    minotaur->setPosition(*minotaurPos);
-    labyrinth->getCell(minotaurPos->getRow(), minotaurPos->getCol()).setVal('M'); // 'M' represents the minotaur
+    const std::vector<Cell*> pathCells(path.begin(), path.end());
+    for (unsigned int i = 0; i < minotaurCount; i++) {
+        int rndPos = randomNumBetween(7, static_cast<int>(pathCells.size()) - 7); // Avoid spawning too close to start/end
+        Cell* minotaurPos = pathCells[rndPos];
+        minotaurs.add(cellIndex(*minotaurPos));
+
+        if (events.isOpen()) {
+            events.record(GameEventType::MINOTAUR_SPAWNED, tick, minotaurPos->getRow(), minotaurPos->getCol());
+        }
+    }
 
-    logger.log("Minotaur spawned at: " + std::to_string(minotaurPos->getRow()) + " " + std::to_string(minotaurPos->getCol()));
+    // Items go on distinct free cells, chosen by one pass of selection sampling over the floor
+    // cells the labyrinth lists for all games: each free cell is taken with probability
+    // (items still needed) / (free cells still ahead), so no per-game list is built
+    const std::vector<uint32_t>& candidates = reachableItemsOnly ? labyrinth->getReachableFloorCells() : labyrinth->getFloorCells();
+    const uint32_t playerCell = cellIndex(startPoint);
+    auto isFree = [&](uint32_t cell) { return cell != playerCell && !minotaurs.isOccupied(cell); };
+    std::size_t freeCount = 0;
+    for (uint32_t cell : candidates) {
+        freeCount += isFree(cell);
+    }
+    std::size_t itemCount = static_cast<std::size_t>(numItems);
+    if (itemCount > freeCount) {
+        LOG_WARN(logger, "Only " + std::to_string(freeCount) + " free cells for " +
+                         std::to_string(numItems) + " items.");
+        itemCount = freeCount;
+    }
 
-    // Lambda function to check if a position is suitable for placing an item
-    auto checkPosForItem = [&](const Cell& pos) -> bool {
-        return labyrinth->getCell(pos.getRow(), pos.getCol()).getVal() == ' ';
-    };
+    // All items and their cell index go into one block allocated up front
+    items.reset(itemCount);
 
     // Spawn Items
-    for (unsigned int i = 0; i < numItems; ++i)
+    const uint32_t width = labyrinth->getWidth();
+    std::size_t needed = itemCount;
+    for (std::size_t i = 0; i < candidates.size() && needed > 0; ++i)
     {
-        int rndNum = rand() % 4; // Randomly choose item type (0-3)
+        const uint32_t cell = candidates[i];
+        if (!isFree(cell)) {
+            continue;
+        }
+        const bool take = rng() % freeCount < needed;
+        freeCount--;
+        if (!take) {
+            continue;
+        }
+        needed--;
 
-        // Generate a random position within the labyrinth boundaries (excluding borders)
+        int rndNum = static_cast<int>(rng() % 4); // Randomly choose item type (0-3)
         Cell item_pos(
-            randomNumBetween(1, labyrinth->getHeight() - 2),
-            randomNumBetween(1, labyrinth->getWidth() - 2),
+            static_cast<int>(cell / width),
+            static_cast<int>(cell % width),
             'P' // 'P' represents a generic item
         );
 
-        // Ensure the item is placed on an empty cell
-        while (!checkPosForItem(item_pos)) {
-            item_pos.setRow(randomNumBetween(1, labyrinth->getHeight() - 2));
-            item_pos.setCol(randomNumBetween(1, labyrinth->getWidth() - 2));
+        // The kind tag selects the item type; the item is stored by value in the next slot of the pool
+        // and indexed by its cell
+        const int itemId = items.create(Item(static_cast<ItemKind>(rndNum), item_pos), cell);
+
+        // Record the new item
+        if (itemId >= 0) {
+            if (events.isOpen()) {
+                events.record(GameEventType::ITEM_SPAWNED, tick, item_pos.getRow(), item_pos.getCol(),
+                              static_cast<uint32_t>(itemId), static_cast<uint8_t>(items[itemId].getKind()));
+            }
+        } else {
+            LOG_WARN(logger, "Problem with item spawn.");
         }
+    }
 
-        logger.log("Generated position for item: " + std::to_string(item_pos.getRow()) + " " + std::to_string(item_pos.getCol()));
+    // No effect is running yet; the minotaurs' first move is due `minotaurTicks` ticks from now
+    turnTimers.reset(stats.turns);
+    clockTimers.reset(tick);
+    clockTime = tick;
+    clockTimers.schedule(tick + minotaurTicks, TIMER_MINOTAUR_MOVE, 0);
+    return true;
+}
 
-        // Instantiate the appropriate item based on rndNum
-        Item* newItem = nullptr;
+/**
+ * @brief Determines if a wall cell was broken with the hummer.
+ * 
+ * @param position The cell position to check.
+ * @return true If the player broke the wall at this position.
+ */
+bool Game::isBrokenWall(const Cell& position) const {
+    // At most one wall per hummer is broken, a linear scan is cheaper than any set
+    return std::find(brokenWalls.begin(), brokenWalls.end(), cellIndex(position)) != brokenWalls.end();
+}
 
-        switch (rndNum)
-        {
-            case 0:
-                newItem = new FogOfWar(item_pos);
-                break;
-            case 1:
-                newItem = new Hummer(item_pos);
-                break;
-            case 2:
-                newItem = new Shield(item_pos);
-                break;
-            case 3:
-                newItem = new Sword(item_pos);
-                break;
-            default:
-                logger.log("Problem with item spawn.");
-                break;
-        }
+/**
+ * @brief Retrieves the directions in which the player or the minotaur may step from a cell.
+ * 
+ * @param position The cell position.
+ * @return uint8_t Bit d set if the neighbour in Labyrinth::Direction d is neither a wall nor the entrance.
+ */
+uint8_t Game::openDirections(const Cell& position) const {
+    return getView().openDirections(position.getRow(), position.getCol());
+}
 
-        // Add the new item to the items list and update the labyrinth cell
-        if (newItem) {
-            logger.log("Item spawned at: " 
-                + std::to_string(newItem->getPosition().getRow()) + " " 
-                + std::to_string(newItem->getPosition().getCol()));
-            labyrinth->setCell(item_pos.getRow(), item_pos.getCol(), Cell(item_pos.getRow(), item_pos.getCol(), 'P'));
-            items.push_back(newItem); // Store the raw pointer
-        }
-    }
+/**
+ * @brief Converts a position to its row-major cell index.
+ * 
+ * @param position The cell position.
+ * @return uint32_t row * width + col.
+ */
+uint32_t Game::cellIndex(const Cell& position) const {
+    return static_cast<uint32_t>(position.getRow()) * labyrinth->getWidth() + static_cast<uint32_t>(position.getCol());
 }
 
-// Checks if a given position is a wall or entrance
 /**
- * @brief Determines if a specific cell is a wall or the entrance.
+ * @brief Finds the item lying at a position.
  * 
  * @param position The cell position to check.
- * @return true If the cell is a wall ('#') or the entrance ('U').
- * @return false Otherwise.
+ * @return int The item id, or -1 if no item lies there.
  */
-bool Game::isWall(const Cell& position) const {
-    char cellVal = labyrinth->getCell(position.getRow(), position.getCol()).getVal();
-    return cellVal == '#' || cellVal == 'U';
+int Game::itemAt(const Cell& position) const {
+    return items.at(cellIndex(position));
 }
 
 // Checks if a given position is on the border of the map
@@ -278,24 +548,29 @@ bool Game::isMapBorder(const Cell& position) const {
  */
 void Game::playerMovementUpdate(char command) {
     Cell potential_pos;
+    Labyrinth::Direction direction;
 
     // Determine the potential new position based on the command
     switch (command)
     {
         case 'w': // Move Up
             potential_pos = Cell(player->getPosition().getRow() - 1, player->getPosition().getCol(), 'R');
+            direction = Labyrinth::DIRECTION_UP;
             break;
 
         case 's': // Move Down
             potential_pos = Cell(player->getPosition().getRow() + 1, player->getPosition().getCol(), 'R');
+            direction = Labyrinth::DIRECTION_DOWN;
             break;
 
         case 'a': // Move Left
             potential_pos = Cell(player->getPosition().getRow(), player->getPosition().getCol() - 1, 'R');
+            direction = Labyrinth::DIRECTION_LEFT;
             break;
 
         case 'd': // Move Right
             potential_pos = Cell(player->getPosition().getRow(), player->getPosition().getCol() + 1, 'R');
+            direction = Labyrinth::DIRECTION_RIGHT;
             break;
 
         default:
@@ -303,29 +578,20 @@ void Game::playerMovementUpdate(char command) {
     }
 
     // Check if the potential position is not a wall
-    if (!isWall(potential_pos)) {
-
-        // Clear the player's current position in the labyrinth
-        labyrinth->getCell(player->getPosition().getRow(), player->getPosition().getCol()).setVal(' ');
+    if (openDirections(player->getPosition()) & (1u << direction)) {
 
         // Update the player's position
         player->setPosition(potential_pos);
 
-        // Set the new position in the labyrinth to 'R' (player)
-        labyrinth->getCell(potential_pos.getRow(), potential_pos.getCol()).setVal('R');
+        // Count the move; running item effects and the immunity may run out
+        advanceTurn();
 
-        // If the player is immune to the minotaur, decrease the immunity duration
-        if (player->isImmuneToMinotaur()) {
-            player->decreaseImmuneDuration();
+        // Record the player's action and new position
+        if (events.isOpen()) {
+            events.record(GameEventType::PLAYER_MOVED, tick, potential_pos.getRow(), potential_pos.getCol(),
+                          GameEvent::NO_ITEM, static_cast<uint8_t>(command));
         }
 
-        // Update active item effects
-        itemsEffectUpdate();
-
-        // Log the player's action and new position
-        logger.log("Action: " + std::string(1, command));
-        logger.log("Player moved to: " + std::to_string(player->getPosition().getRow()) + " " + std::to_string(player->getPosition().getCol()));
-
         return;
     }
 
@@ -337,91 +603,106 @@ void Game::playerMovementUpdate(char command) {
 
         // Remove the Hummer effect after using it to destroy a wall
         player->removeHummerEffect();
-
-        // Clear the player's current position in the labyrinth
-        labyrinth->getCell(player->getPosition().getRow(), player->getPosition().getCol()).setVal(' ');
+        brokenWalls.push_back(cellIndex(potential_pos));
 
         // Update the player's position to the wall's position
         player->setPosition(potential_pos);
 
-        // Set the new position in the labyrinth to 'R' (player)
-        labyrinth->getCell(potential_pos.getRow(), potential_pos.getCol()).setVal('R');
+        // Count the move; running item effects and the immunity may run out
+        advanceTurn();
 
-        // If the player is immune to the minotaur, decrease the immunity duration
-        if (player->isImmuneToMinotaur()) {
-            player->decreaseImmuneDuration();
+        // Record the player's action and new position
+        if (events.isOpen()) {
+            events.record(GameEventType::PLAYER_MOVED, tick, potential_pos.getRow(), potential_pos.getCol(),
+                          GameEvent::NO_ITEM, static_cast<uint8_t>(command));
         }
-
-        // Update active item effects
-        itemsEffectUpdate();
-
-        // Log the player's action and new position
-        logger.log("Action: " + std::string(1, command));
-        logger.log("Player moved to: " + std::to_string(player->getPosition().getRow()) + " " + std::to_string(player->getPosition().getCol()));
     }
 }
 
-// Updates the minotaur's position randomly, avoiding walls and the end point
+// Updates the minotaurs' positions, avoiding walls and the end point
 /**
- * @brief Moves the minotaur randomly within the labyrinth, avoiding walls and the exit.
+ * @brief Moves every living minotaur one cell, avoiding walls and the exit.
  * 
  * @details 
- * Attempts to move the minotaur in a random direction up to a maximum number of attempts.
- * Ensures the minotaur does not move into walls or the exit point.
- * Logs the minotaur's new position after a successful move.
+ * The open directions of a minotaur's cell come from the labyrinth's precomputed mask,
+ * without the exit. A random minotaur picks one of them with one random number, so it always
+ * moves unless it is walled in. A chasing minotaur takes the direction that lowers its
+ * distance in the shared chase field, falling back to a random move only if the player
+ * cannot be reached from its cell. The cost is one step per minotaur plus at most one
+ * breadth-first search for all of them. Logs the minotaurs' new positions.
  */
 void Game::minotaurMovementUpdate()
 {
-    Cell minotaur_pos = minotaur->getPosition();
-
-    const int MAX_ATTEMPTS = 4; // Maximum attempts to move
-    bool moved = false;
+    if (chasingMinotaurs) {
+        updateChaseField();
+    }
 
-    // Attempt to move the minotaur up to MAX_ATTEMPTS times
-    for (int attempt = 0; attempt < MAX_ATTEMPTS && !moved; ++attempt)
-    {
-        int randomDirection = rand() % 4; // Randomly choose a direction
-        Cell potential_pos;
+    const GameView view = getView();
+    const uint32_t width = labyrinth->getWidth();
+    const uint32_t exitCell = cellIndex(labyrinth->getEndPoint());
+    const int32_t offsets[Labyrinth::DIRECTION_COUNT] = { -static_cast<int32_t>(width), static_cast<int32_t>(width), -1, 1 };
 
-        // Determine the potential new position based on the random direction
-        switch (randomDirection) {
-            case 0: // Move Up
-                potential_pos = Cell(minotaur_pos.getRow() - 1, minotaur_pos.getCol(), 'M');
-                break;
-            case 1: // Move Down
-                potential_pos = Cell(minotaur_pos.getRow() + 1, minotaur_pos.getCol(), 'M');
-                break;
-            case 2: // Move Left
-                potential_pos = Cell(minotaur_pos.getRow(), minotaur_pos.getCol() - 1, 'M');
-                break;
-            case 3: // Move Right
-                potential_pos = Cell(minotaur_pos.getRow(), minotaur_pos.getCol() + 1, 'M');
-                break;
-            default:
-                break;
+    for (uint32_t index = 0; index < minotaurs.size(); index++) {
+        if (!minotaurs.isAlive(index)) {
+            continue;
+        }
+        const uint32_t cell = minotaurs.getCell(index);
+        const int row = minotaurs.getRow(index);
+        const int col = minotaurs.getCol(index);
+
+        // Every open direction except the one leading onto the exit
+        const uint8_t open = static_cast<uint8_t>(view.openDirections(row, col) & ~Labyrinth::directionBit(cell, exitCell, width));
+        if (open == 0) {
+            continue;
         }
 
-        // Check if the potential position is not a wall
-        if (!isWall(potential_pos)) {
-
-            // Ensure the minotaur does not move to the end point
-            if (potential_pos == labyrinth->getEndPoint()) continue;
-
-            // Clear the minotaur's current position in the labyrinth
-            labyrinth->getCell(minotaur_pos.getRow(), minotaur_pos.getCol()).setVal(' ');
-
-            // Update the minotaur's position
-            minotaur->setPosition(potential_pos);
-
-            // Set the new position in the labyrinth to 'M' (minotaur)
-            labyrinth->getCell(potential_pos.getRow(), potential_pos.getCol()).setVal('M');
+        int direction = -1;
+        const uint32_t distance = chasingMinotaurs ? chaseField->at(row, col) : DistanceField::UNREACHABLE;
+        if (distance != DistanceField::UNREACHABLE) {
+            // Step down the field; a minotaur on the player's cell stays there
+            uint32_t best = distance;
+            for (int d = 0; d < Labyrinth::DIRECTION_COUNT; d++) {
+                const uint32_t next = (open & (1u << d)) ? chaseField->at(row + Labyrinth::DIRECTION_ROW[d], col + Labyrinth::DIRECTION_COL[d])
+                                                         : DistanceField::UNREACHABLE;
+                if (next < best) {
+                    best = next;
+                    direction = d;
+                }
+            }
+        } else {
+            direction = Labyrinth::nthDirection(open, static_cast<unsigned int>(rng() % __builtin_popcount(open)));
+        }
+        if (direction < 0) {
+            continue;
+        }
+        minotaurs.moveTo(index, cell + offsets[direction]);
 
-            moved = true; // Mark as moved to exit the loop
+        // Record the minotaur's new position
+        if (events.isOpen()) {
+            events.record(GameEventType::MINOTAUR_MOVED, tick, minotaurs.getRow(index), minotaurs.getCol(index));
         }
     }
+}
 
-    // Log the minotaur's new position
-    logger.log("Minotaur moved to: " + std::to_string(minotaur->getPosition().getRow()) + " " + std::to_string(minotaur->getPosition().getCol()));
+/**
+ * @brief Recomputes `chaseField` if the player moved or broke a wall since the last computation.
+ * 
+ * @details 
+ * The field holds the distance of every cell to the player, so all chasing minotaurs read
+ * their next step from it instead of searching a path each.
+ */
+void Game::updateChaseField()
+{
+    const uint32_t source = cellIndex(player->getPosition());
+    if (source == chaseFieldSource && brokenWalls.size() == chaseFieldWalls) {
+        return;
+    }
+    const GameView view = getView();
+    chaseField->begin(view);
+    chaseField->addSource(view, player->getPosition().getRow(), player->getPosition().getCol());
+    chaseField->run(view);
+    chaseFieldSource = source;
+    chaseFieldWalls = brokenWalls.size();
 }
 
 // Handles collisions between the player, minotaur, and items
@@ -435,17 +716,20 @@ void Game::minotaurMovementUpdate()
  */
 void Game::checkGameObjectCollision()
 {
-    // Check if the player and minotaur occupy the same position and the player is not immune
-    if (player->getPosition() == minotaur->getPosition() && minotaur->isAlive() && !player->isImmuneToMinotaur()) 
+    // Check if the player stands on a living minotaur and is not immune
+    if (minotaurs.isOccupied(cellIndex(player->getPosition())) && !player->isImmuneToMinotaur()) 
     {
         if (player->hasShieldEffect()) {
             player->removeShieldEffect(); // Absorb the attack with the shield
-            player->setImmuneToMinotaur(true, 2); // Grant temporary immunity
+            player->addEffect(Player::EFFECT_IMMUNITY, stats.turns + 2); // Grant immunity for two turns
+            turnTimers.schedule(stats.turns + 2, TIMER_EFFECTS_EXPIRY, 0);
         }
         else {
             state = GAME_STATE::PLAYER_LOST; // Player is defeated by the minotaur
-            labyrinth->getCell(player->getPosition().getRow(), player->getPosition().getCol()).setVal('M');
-            logger.log("Game state updated: " + std::to_string(state));
+            if (events.isOpen()) {
+                events.record(GameEventType::STATE_CHANGED, tick, player->getPosition().getRow(), player->getPosition().getCol(),
+                              GameEvent::NO_ITEM, static_cast<uint8_t>(state));
+            }
             return;
         }
     }
@@ -454,59 +738,131 @@ void Game::checkGameObjectCollision()
     if (player->getPosition() == labyrinth->getEndPoint())
     {
         state = GAME_STATE::PLAYER_WON; // Player wins the game
-        logger.log("Game state updated: " + std::to_string(state));
+        if (events.isOpen()) {
+            events.record(GameEventType::STATE_CHANGED, tick, player->getPosition().getRow(), player->getPosition().getCol(),
+                          GameEvent::NO_ITEM, static_cast<uint8_t>(state));
+        }
         return;
     }
 
-    // Iterate through all items to check for collisions
-    for (auto it = items.begin(); it != items.end(); ++it)
-    {
-        Item* currentItem = *it;
+    // Only the cells of the player and the minotaurs can hold an item to collide with
+    int itemId = itemAt(player->getPosition());
 
-        // Player picks up an item
-        if (currentItem->getPosition() == player->getPosition() && !currentItem->isUsed())
-        {
-            currentItem->activate();                 // Activate the item
-            currentItem->applyEffect(*player);       // Apply the item's effect to the player
-            currentItem->setUsed();                  // Mark the item as used to prevent reactivation
-            labyrinth->getCell(player->getPosition().getRow(), player->getPosition().getCol()).setVal('R'); // Update cell symbol
-            logger.log("Item activated at: " + std::to_string(currentItem->getPosition().getRow()) + " " + std::to_string(currentItem->getPosition().getCol()));
+    // Player picks up an item
+    if (itemId >= 0)
+    {
+        Item* currentItem = &items[itemId];
+        const uint32_t expiresAt = stats.turns + static_cast<uint32_t>(currentItem->getEffectDuration());
+        currentItem->activate();                     // Activate the item
+        currentItem->applyEffect(*player, expiresAt); // Apply the item's effect to the player until it runs out
+        items.retire(itemId);                        // Mark the item as used to prevent reactivation
+        turnTimers.schedule(expiresAt, TIMER_ITEM_EXPIRY, static_cast<uint32_t>(itemId));
+        stats.pickups[static_cast<std::size_t>(currentItem->getKind())]++;
+        if (events.isOpen()) {
+            events.record(GameEventType::ITEM_ACTIVATED, tick, currentItem->getPosition().getRow(), currentItem->getPosition().getCol(),
+                          static_cast<uint32_t>(itemId), static_cast<uint8_t>(currentItem->getKind()));
         }
+    }
 
-        // Minotaur destroys an item
-        if (currentItem->getPosition() == minotaur->getPosition() && !currentItem->isUsed())
-        {
-            currentItem->deactivate();                // Deactivate the item's effect
-            currentItem->setUsed();                    // Mark the item as used
-            logger.log("Item deactivated at: " + std::to_string(currentItem->getPosition().getRow()) + " " + std::to_string(currentItem->getPosition().getCol()));
+    // Minotaurs destroy the items they stand on
+    for (uint32_t index = 0; index < minotaurs.size() && items.liveCount() > 0; index++) {
+        if (!minotaurs.isAlive(index)) {
+            continue;
+        }
+        itemId = items.at(minotaurs.getCell(index));
+        if (itemId < 0) {
+            continue;
+        }
+        Item* currentItem = &items[itemId];
+        currentItem->deactivate();                // Deactivate the item's effect
+        items.retire(itemId);                      // Mark the item as used
+        stats.itemsDestroyed++;
+        if (events.isOpen()) {
+            events.record(GameEventType::ITEM_DESTROYED, tick, currentItem->getPosition().getRow(), currentItem->getPosition().getCol(),
+                          static_cast<uint32_t>(itemId), static_cast<uint8_t>(currentItem->getKind()));
         }
     }
 }
 
-// Updates the duration of active item effects and removes them if expired
+// Counts a player move and runs the turn timers that are due
+/**
+ * @brief Counts a player move and fires the turn timers that are due.
+ * 
+ * @details 
+ * Item effects and the immunity are timers on `turnTimers`, scheduled when they start, so a
+ * move only touches the effects that end on it.
+ */
+void Game::advanceTurn()
+{
+    stats.turns++;
+    player->setTurn(stats.turns);
+    turnTimers.advance(stats.turns, [this](const TimerWheel::Timer& timer) { fireTimer(timer); });
+}
+
 /**
- * @brief Updates the duration of active item effects and removes them if their duration has expired.
+ * @brief Moves the game clock to `time` and fires the clock timers that are due.
+ * 
+ * @param time The tick to advance to.
+ * @return std::size_t Number of timers that fired.
+ */
+std::size_t Game::advanceClock(uint64_t time)
+{
+    std::size_t fired = 0;
+    clockTime = time;
+    clockTimers.advance(time, [this, &fired](const TimerWheel::Timer& timer) {
+        fireTimer(timer);
+        fired++;
+    });
+    return fired;
+}
+
+/**
+ * @brief Performs the action of a timer of `turnTimers` or `clockTimers`.
+ * 
+ * @param timer The timer that fired.
  * 
  * @details 
- * Iterates through all items, decrementing their effect durations. If an item's effect duration reaches zero,
- * the effect is removed from the player, and the item is deactivated and marked as used.
+ * - An expired item has its effect removed from the player and is deactivated and marked as used.
+ * - The end of the immunity makes the player vulnerable to the minotaur again.
+ * - The minotaurs move and their next move is scheduled one period after the current clock time,
+ *   for as long as one of them is alive.
  */
-void Game::itemsEffectUpdate()
+void Game::fireTimer(const TimerWheel::Timer& timer)
 {
-    for (auto it = items.begin(); it != items.end(); ++it)
+    switch (timer.type)
     {
-        Item* currentItem = *it;
-        if (currentItem->isActive())
+        case TIMER_ITEM_EXPIRY:
         {
-            currentItem->setEffectDuration(currentItem->getEffectDuration() - 1); // Decrease effect duration
-            if (currentItem->getEffectDuration() == 0)
+            Item* currentItem = &items[timer.id];
+            if (!currentItem->isActive())
             {
-                currentItem->removeEffect(*player); // Remove the effect from the player
-                currentItem->deactivate();          // Deactivate the item
-                currentItem->setUsed();             // Mark the item as used
-                logger.log("Item deactivated at: " + std::to_string(currentItem->getPosition().getRow()) + " " + std::to_string(currentItem->getPosition().getCol()));
+                break;
             }
+            currentItem->deactivate();          // Deactivate the item
+            currentItem->setUsed();             // Mark the item as used
+            currentItem->setEffectDuration(0);
+            if (events.isOpen()) {
+                events.record(GameEventType::ITEM_EXPIRED, tick, currentItem->getPosition().getRow(), currentItem->getPosition().getCol(),
+                              timer.id, static_cast<uint8_t>(currentItem->getKind()));
+            }
+
+            // The effect ends unless a later item of the same kind extended it
+            player->expireEffects(stats.turns);
+            break;
         }
+        case TIMER_EFFECTS_EXPIRY:
+            player->expireEffects(stats.turns);
+            break;
+
+        case TIMER_MINOTAUR_MOVE:
+            if (state == GAME_STATE::PLAYING && minotaurs.countAlive() > 0) {
+                minotaurMovementUpdate();
+                clockTimers.schedule(clockTime + minotaurTicks, TIMER_MINOTAUR_MOVE, 0);
+            }
+            break;
+
+        default:
+            break;
     }
 }
 
@@ -528,41 +884,171 @@ void Game::attackMinotaur()
 
         int attackRadius = 1; // Define the attack radius (1 cell in each direction)
 
-        // Iterate through all cells within the attack radius
-        for (int dr = -attackRadius; dr <= attackRadius; ++dr) 
-        {
-            for (int dc = -attackRadius; dc <= attackRadius; ++dc) 
-            {
-                int targetRow = playerRow + dr;
-                int targetCol = playerCol + dc;
-
-                // Ensure the target cell is within the labyrinth boundaries
+        // The minotaurs in reach are looked up cell by cell in the herd
+        const uint32_t width = labyrinth->getWidth();
+        int target = -1;
+        int targetRow = 0;
+        int targetCol = 0;
+        for (int dr = -attackRadius; dr <= attackRadius && target < 0; dr++) {
+            for (int dc = -attackRadius; dc <= attackRadius && target < 0; dc++) {
+                targetRow = playerRow + dr;
+                targetCol = playerCol + dc;
                 if (targetRow >= 0 && targetRow < static_cast<int>(labyrinth->getHeight()) &&
-                    targetCol >= 0 && targetCol < static_cast<int>(labyrinth->getWidth())) 
-                {
-                    char cellVal = labyrinth->getCell(targetRow, targetCol).getVal();
-
-                    // Check if the minotaur is in the target cell
-                    if (cellVal == 'M') 
-                    {
-                        labyrinth->getCell(targetRow, targetCol).setVal(' '); // Remove the minotaur from the cell
-                        minotaur->kill();                                      // Kill the minotaur
-                        player->removeSwordEffect();                           // Remove the sword effect from the player
-
-                        logger.log("Minotaur attacked and killed at position: (" + 
-                                   std::to_string(targetRow) + ", " + std::to_string(targetCol) + ")");
-
-                        return; // Exit after killing the minotaur
-                    }
+                    targetCol >= 0 && targetCol < static_cast<int>(width)) {
+                    target = minotaurs.findAt(static_cast<uint32_t>(targetRow) * width + static_cast<uint32_t>(targetCol));
                 }
             }
         }
 
-        // Log if no minotaur was found within the attack range
-        logger.log("Attack attempted, but no minotaur found within attack range.");
+        if (target >= 0) 
+        {
+            minotaurs.kill(static_cast<uint32_t>(target)); // Kill the minotaur
+            player->removeSwordEffect();        // Remove the sword effect from the player
+            stats.minotaurKills++;
+
+            if (events.isOpen()) {
+                events.record(GameEventType::MINOTAUR_KILLED, tick, targetRow, targetCol);
+            }
+
+            return; // Exit after killing the minotaur
+        }
+
+        // Record that no minotaur was found within the attack range
+        if (events.isOpen()) {
+            events.record(GameEventType::ATTACK_MISSED, tick, playerRow, playerCol);
+        }
     }
 }
 
+/**
+ * @brief Maps a key of the interactive game to an action.
+ * 
+ * @param key The pressed key.
+ * @return PlayerAction The matching action, PlayerAction::NONE for other keys.
+ */
+PlayerAction Game::actionFromKey(char key)
+{
+    switch (key) {
+        case 'w': return PlayerAction::UP;
+        case 's': return PlayerAction::DOWN;
+        case 'a': return PlayerAction::LEFT;
+        case 'd': return PlayerAction::RIGHT;
+        case ' ': return PlayerAction::ATTACK;
+        case 'q': return PlayerAction::QUIT;
+        default:  return PlayerAction::NONE;
+    }
+}
+
+/**
+ * @brief Applies one player action: a move, an attack or quitting.
+ * 
+ * @param action The action to apply; PlayerAction::NONE does nothing.
+ */
+void Game::handleAction(PlayerAction action)
+{
+    switch (action) {
+        case PlayerAction::QUIT: // Quit the game
+            state = GAME_STATE::QUIT;
+            if (events.isOpen()) {
+                events.record(GameEventType::STATE_CHANGED, tick, player->getPosition().getRow(), player->getPosition().getCol(),
+                              GameEvent::NO_ITEM, static_cast<uint8_t>(state));
+            }
+            break;
+        case PlayerAction::ATTACK: // Player attacks minotaur
+            attackMinotaur();
+            break;
+        case PlayerAction::UP:
+            playerMovementUpdate('w');
+            break;
+        case PlayerAction::DOWN:
+            playerMovementUpdate('s');
+            break;
+        case PlayerAction::LEFT:
+            playerMovementUpdate('a');
+            break;
+        case PlayerAction::RIGHT:
+            playerMovementUpdate('d');
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Advances a headless game by one tick.
+ * 
+ * @param action The player's action for this tick.
+ * 
+ * @details 
+ * Runs the same rules as one iteration of updateGameState(), without input, rendering or
+ * waiting for the simulation clock, so a headless game plays out exactly as an interactive
+ * one with the same seed and the same key per tick.
+ */
+void Game::step(PlayerAction action)
+{
+    if (!ready || state != GAME_STATE::PLAYING) {
+        return;
+    }
+
+    replay.record(tick, static_cast<uint8_t>(action));
+    handleAction(action);
+
+    // The minotaur's move is a timer due every `minotaurTicks` ticks
+    if (state == GAME_STATE::PLAYING) {
+        advanceClock(tick + 1);
+    }
+    if (state == GAME_STATE::PLAYING) {
+        checkGameObjectCollision();
+    }
+
+    tick++;
+    stats.ticks = tick;
+    if (state != GAME_STATE::PLAYING) {
+        replay.finish(tick);
+    }
+}
+
+/**
+ * @brief Creates a read-only view of the game for automated players.
+ * 
+ * @return GameView View of the grid, the player, the minotaur and the items.
+ */
+GameView Game::getView() const
+{
+    return GameView(labyrinth.get(), player, minotaur, &minotaurs, &items, &brokenWalls, labyrinth->getEndPoint(),
+                    static_cast<int>(labyrinth->getWidth()), static_cast<int>(labyrinth->getHeight()), tick);
+}
+
+/**
+ * @brief Retrieves the symbol drawn for a cell: the terrain with the entities on top.
+ * 
+ * @param row The row index of the cell.
+ * @param col The column index of the cell.
+ * @return char The symbol the rendered map shows at this cell.
+ */
+char Game::symbolAt(unsigned int row, unsigned int col) const
+{
+    Cell position(row, col, ' ');
+
+    // A minotaur covers a defeated player, otherwise the player is drawn on top
+    const bool minotaurHere = minotaurs.countAlive() > 0 && minotaurs.isOccupied(cellIndex(position));
+    if (minotaurHere && state == GAME_STATE::PLAYER_LOST) {
+        return 'M';
+    }
+    if (player && player->getPosition() == position) {
+        return 'R';
+    }
+    if (minotaurHere) {
+        return 'M';
+    }
+    if (itemAt(position) >= 0) {
+        return 'P';
+    }
+
+    char val = labyrinth->getCell(row, col).getVal();
+    return (val == '#' && isBrokenWall(position)) ? ' ' : val;
+}
+
 // Main game loop that updates the game state continuously until the game ends
 /**
  * @brief Starts and manages the main game loop, handling player input, minotaur movement, collisions, and rendering.
@@ -573,95 +1059,103 @@ void Game::attackMinotaur()
  */
 void Game::updateGameState()
 {
-    logger.log("Game state updated: " + std::to_string(state));
-    srand(static_cast<unsigned int>(time(nullptr))); // Seed the random number generator
+    TRACE_SCOPE("Game::updateGameState");
+    LOG_INFO(logger, "Game state updated: " + std::to_string(state));
     input::enableRawMode(); // Enable raw mode for capturing input without waiting for Enter
 
-    auto lastMinotaurUpdate = std::chrono::steady_clock::now(); // Timestamp for minotaur's last move
+    // The clock timers count ticks as in step(); the simulation clock maps them to wall time,
+    // SimClock::TICK_MILLIS each, so the default minotaur moves once a second
+    simClock.start();
+    const uint32_t firstTick = tick;
+
+    // Only the interactive loop is timed; headless games never pay for the histograms
+    if (!telemetry) {
+        telemetry.reset(new FrameTelemetry());
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto nanosBetween = [](Clock::time_point from, Clock::time_point to) -> uint64_t {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+    };
+
+    // A key read in this frame was pressed at the earliest right after the previous poll
+    const auto loopStart = Clock::now();
+    auto lastPoll = loopStart;
 
     // Main game loop
     while (state == GAME_STATE::PLAYING)
     {	
-        // Handle player input
+        TRACE_SCOPE("tick");
+        const auto frameStart = Clock::now();
+        const auto previousPoll = lastPoll;
+        lastPoll = frameStart;
+        telemetry->setTime(nanosBetween(loopStart, frameStart));
+        bool keyRead = false;
+
+        // Handle player input: at most one key per tick
         if (input::kbhit()) {
             char command = input::getch(); // Get the pressed key
-
-            // Handle different commands
-            switch (command) {
-                case 'q': // Quit the game
-                    state = GAME_STATE::QUIT;
-                    logger.log("Game state updated: " + std::to_string(state));
-                    break;
-                case ' ': // Player attacks minotaur
-                    attackMinotaur();
-                    break;
-                default: // Handle movement commands
-                    playerMovementUpdate(command);
-                    break;
-            }
+            keyRead = true;
+            const PlayerAction action = actionFromKey(command);
+            replay.record(tick, static_cast<uint8_t>(action));
+            handleAction(action);
         }
 
-        // Handle minotaur movement at fixed intervals (every 1 second)
-        auto now = std::chrono::steady_clock::now();
-        auto diffSec = std::chrono::duration<double>(now - lastMinotaurUpdate).count();
+        // Handle minotaur movement on the tick clock, in the same order as step()
+        auto now = Clock::now();
+        telemetry->record(FramePhase::INPUT, nanosBetween(frameStart, now));
 
-        if (diffSec >= 1.0 && minotaur->isAlive()) {
-            minotaurMovementUpdate();            
-            lastMinotaurUpdate = std::chrono::steady_clock::now();
+        if (state == GAME_STATE::PLAYING && advanceClock(tick + 1) > 0) {
+            telemetry->record(FramePhase::MINOTAUR, nanosBetween(now, Clock::now()));
         }
 
         // Check for collisions between game objects
-        checkGameObjectCollision();
+        const auto collisionStart = Clock::now();
+        if (state == GAME_STATE::PLAYING) {
+            checkGameObjectCollision();
+        }
+        const auto renderStart = Clock::now();
+        telemetry->record(FramePhase::COLLISION, nanosBetween(collisionStart, renderStart));
 
         // Render the current state of the map
         printMap();
 
-        // Display active effects on the player with colored messages
-        if (player->isImmuneToMinotaur()) {
-            std::cout << termcolor::on_yellow << termcolor::bold 
-                      << "Immune to Minotaur for " << player->getImmuneDuration() << " moves." 
-                      << termcolor::reset << std::endl;
-        }
-        if (player->hasSwordEffect()) {
-            std::cout << termcolor::on_bright_red << termcolor::bold 
-                      << "Sword effect active." 
-                      << termcolor::reset << std::endl;
-        }
-        if (player->hasShieldEffect()) {
-            std::cout << termcolor::on_bright_green << termcolor::bold 
-                      << "Shield effect active." 
-                      << termcolor::reset << std::endl;
-        }
-        if (player->hasHummerEffect()) {
-            std::cout << termcolor::bright_yellow << termcolor::bold 
-                      << "Hummer effect active." 
-                      << termcolor::reset << std::endl;
+        // Display active effects on the player with colored messages, immunity first
+        for (unsigned int mask = player->getEffects(); mask != 0; ) {
+            const unsigned int effect = 31 - static_cast<unsigned int>(__builtin_clz(mask));
+            mask &= ~(1u << effect);
+            std::cout << EFFECT_COLORS[effect] << termcolor::bold;
+            if (effect == Player::EFFECT_IMMUNITY) {
+                std::cout << "Immune to Minotaur for " << player->getImmuneDuration() << " moves.";
+            } else {
+                std::cout << Item::describe(static_cast<ItemKind>(effect)).infoMessage;
+            }
+            std::cout << termcolor::reset << std::endl;
         }
-        if (player->hasFogOfWarEffect()) {
-            std::cout << termcolor::on_bright_grey << termcolor::bold 
-                      << "Fog of War effect active." 
-                      << termcolor::reset << std::endl;
+
+        // The frame is only visible once it reached the terminal
+        std::cout.flush();
+        const auto renderEnd = Clock::now();
+        telemetry->record(FramePhase::RENDER, nanosBetween(renderStart, renderEnd));
+        if (keyRead) {
+            telemetry->record(FramePhase::INPUT_LATENCY, nanosBetween(previousPoll, renderEnd));
         }
 
-        // Small delay to reduce CPU usage
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        // Wait until the next tick is due; a late frame does not wait at all
+        tick++;
+        stats.ticks = tick;
+        simClock.waitForTick(tick - firstTick);
+        const auto frameEnd = Clock::now();
+        telemetry->record(FramePhase::SLEEP, nanosBetween(renderEnd, frameEnd));
+        telemetry->record(FramePhase::FRAME, nanosBetween(frameStart, frameEnd));
     }
 
     // Final rendering after the game loop ends
-    system("clear"); // Clear the console
-    labyrinth->print(); // Print the final state of the labyrinth
+    replay.finish(tick);
+    printResult();
 
-    // Display the end game message based on the game state
-    switch (state) {
-        case GAME_STATE::PLAYER_WON:
-            printGameWon();
-            break;
-
-        case GAME_STATE::PLAYER_LOST:
-            printGameOver();
-            break;
-        default:
-            break;
+    if (!telemetry->save("telemetry.log")) {
+        LOG_WARN(logger, "Unable to write telemetry.log");
     }
 
     Logger resultLogger("result.log");
@@ -689,15 +1183,13 @@ void Game::updateGameState()
     resultLogger.save("Final player position: " + std::to_string(player->getPosition().getRow()) + " " + std::to_string(player->getPosition().getCol()));
     resultLogger.save("Final minotaur position: " + std::to_string(minotaur->getPosition().getRow()) + " " + std::to_string(minotaur->getPosition().getCol()));
     resultLogger.save("Minotaur alive: " + std::string(minotaur->isAlive() ? "true" : "false"));
+    resultLogger.save("Minotaurs alive: " + std::to_string(minotaurs.countAlive()) + " of " + std::to_string(minotaurs.size()));
 
     // Log final labyrinth state
     resultLogger.save("=== FINAL LABYRINTH STATE ===");
+    const unsigned int width = labyrinth->getWidth();
     for (unsigned int r = 0; r < labyrinth->getHeight(); r++) {
-        std::string row = "";
-        for (unsigned int c = 0; c < labyrinth->getWidth(); c++) {
-            row += labyrinth->getCell(r, c).getVal();
-        }
-        resultLogger.save(row);
+        resultLogger.save(frame.substr(static_cast<std::size_t>(r) * width, width));
     }
     resultLogger.save("=== END FINAL LABYRINTH STATE ===");
 
@@ -714,17 +1206,63 @@ void Game::updateGameState()
  */
 void Game::printMap() 
 {
+    TRACE_SCOPE("Game::printMap");
+
     // Clear the console screen
     std::cout << "\x1B[2J\x1B[H";
 
     // Use the appropriate print method based on whether Fog of War is active
     if (player->hasFogOfWarEffect()) {
-        labyrinth->printWithFogOfWar(player->getPosition());
+        labyrinth->printWithFogOfWar(player->getPosition(), composeFrame());
     } else {
-        labyrinth->print();
+        labyrinth->print(composeFrame());
     }
 }
 
+/**
+ * @brief Draws the terrain, the broken walls and the entities into `frame`.
+ * 
+ * @details 
+ * The terrain is copied row by row, then the few dynamic cells are overwritten in the
+ * same order of precedence as symbolAt(): items, the minotaur, the player (or the minotaur
+ * over a defeated player).
+ * 
+ * @return const std::string& The composed frame.
+ */
+const std::string& Game::composeFrame()
+{
+    const unsigned int width = labyrinth->getWidth();
+    const unsigned int height = labyrinth->getHeight();
+    frame.resize(static_cast<std::size_t>(width) * height);
+
+    for (unsigned int r = 0; r < height; r++) {
+        for (unsigned int c = 0; c < width; c++) {
+            frame[static_cast<std::size_t>(r) * width + c] = labyrinth->getCell(r, c).getVal();
+        }
+    }
+
+    auto draw = [&](const Cell& position, char symbol) {
+        frame[static_cast<std::size_t>(position.getRow()) * width + position.getCol()] = symbol;
+    };
+
+    for (uint32_t index : brokenWalls) {
+        frame[index] = ' ';
+    }
+    for (uint32_t id : items.lying()) {
+        frame[items.cellOf(id)] = 'P';
+    }
+    for (uint32_t index = 0; index < minotaurs.size(); index++) {
+        if (minotaurs.isAlive(index)) {
+            frame[minotaurs.getCell(index)] = 'M';
+        }
+    }
+    draw(player->getPosition(), 'R');
+    if (state == GAME_STATE::PLAYER_LOST && minotaurs.isOccupied(cellIndex(player->getPosition()))) {
+        draw(player->getPosition(), 'M');
+    }
+    return frame;
+}
+
 // Displays a "Game Over" ASCII art message
 /**
  * @brief Displays the "Game Over" ASCII art message.
@@ -763,25 +1301,90 @@ void Game::printGameWon()
               << termcolor::reset << std::endl;
 }
 
+/**
+ * @brief Prints the final map and the "You Won" or "Game Over" message.
+ */
+void Game::printResult()
+{
+    system("clear"); // Clear the console
+    labyrinth->print(composeFrame()); // Print the final state of the labyrinth
+
+    // Display the end game message based on the game state
+    switch (state) {
+        case GAME_STATE::PLAYER_WON:
+            printGameWon();
+            break;
+
+        case GAME_STATE::PLAYER_LOST:
+            printGameOver();
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Plays the actions of a replay until the game ends.
+ * 
+ * @param replay Reader of the replay this game was constructed from.
+ * @param speed Speed-up over real time; 0 (or less) plays as fast as possible.
+ * @param render Draw the map after every tick and the result at the end.
+ * @return true If every recorded action was played and, for a finished recording, the game
+ *         ended on the recorded tick.
+ * 
+ * @details 
+ * Only the next action is held in memory: it is applied in its tick and the following one
+ * is read. Ticks in between run without an action. A recording without an END record (a
+ * game that was interrupted) is played until its last action.
+ */
+bool Game::playReplay(ReplayReader& replay, double speed, bool render)
+{
+    if (!ready || !replay.isValid()) {
+        return false;
+    }
+
+    SimClock clock(speed);
+    const uint32_t firstTick = tick;
+    uint32_t actionTick = 0;
+    uint8_t action = 0;
+    bool pending = replay.next(actionTick, action);
+
+    clock.start();
+    while (state == GAME_STATE::PLAYING && (pending || (replay.hasEnded() && tick < replay.getEndTick()))) {
+        PlayerAction current = PlayerAction::NONE;
+        if (pending && actionTick <= tick) {
+            current = static_cast<PlayerAction>(action);
+            pending = replay.next(actionTick, action);
+        }
+
+        clock.waitForTick(tick - firstTick);
+        step(current);
+        if (render) {
+            printMap();
+            std::cout << "Replay tick " << tick << std::endl;
+        }
+    }
+
+    if (render) {
+        printResult();
+    }
+    return !pending && (!replay.hasEnded() || (state != GAME_STATE::PLAYING && tick == replay.getEndTick()));
+}
+
 // Destructor: Cleans up dynamically allocated memory
 /**
  * @brief Destructor for the Game class.
  * 
  * @details 
- * Deallocates all dynamically allocated memory, including the labyrinth, player, minotaur, and items,
- * to prevent memory leaks.
+ * Deallocates the player, minotaur, and items. The labyrinth is released once the last game
+ * sharing it is destroyed.
  */
 Game::~Game()
 {
-    // Delete dynamically allocated objects to prevent memory leaks
-    if (labyrinth) delete labyrinth;
+    // Delete dynamically allocated objects to prevent memory leaks;
+    // the items go with their pool and the labyrinth with the last game that shares it
     if (player) delete player;
     if (minotaur) delete minotaur;
-
-    // Iterate through the items list and delete each item
-    for (auto it = items.begin(); it != items.end(); ++it) {
-        delete *it;
-    }
 }
 
 /**
@@ -803,7 +1406,17 @@ void Game::start()
  * 
  * @return Pointer to the labyrinth object.
  */
-Labyrinth* Game::getLabyrinth() const
+const Labyrinth* Game::getLabyrinth() const
+{
+    return labyrinth.get();
+}
+
+/**
+ * @brief Gets the shared handle of the labyrinth, to start more games on the same map.
+ * 
+ * @return std::shared_ptr<const Labyrinth> The labyrinth; null if none was created.
+ */
+std::shared_ptr<const Labyrinth> Game::getSharedLabyrinth() const
 {
     return labyrinth;
 }
@@ -828,6 +1441,16 @@ Minotaur* Game::getMinotaur() const
     return minotaur;
 }
 
+/**
+ * @brief Gets all minotaurs of the game.
+ * 
+ * @return const MinotaurHerd& Positions and alive flags of every minotaur.
+ */
+const MinotaurHerd& Game::getMinotaurs() const
+{
+    return minotaurs;
+}
+
 /**
  * @brief Checks if the labyrinth was successfully generated.
  * 
@@ -0,0 +1,507 @@
+#include "GameBatch.h"
+#include "SplitMix64.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief Creates a batch of games on a shared labyrinth and spawns all entities.
+ *
+ * @details The terrain plane, the cell masks and the path are extracted from the labyrinth
+ *          once; all games read them and never touch the labyrinth again.
+ */
+GameBatch::GameBatch(std::shared_ptr<const Labyrinth> labyrinth, std::size_t games, unsigned int seed,
+                     unsigned int itemsPerGame, unsigned int minotaurTicks)
+    : labyrinth(std::move(labyrinth)), games(games), itemsPerGame(itemsPerGame),
+      minotaurTicks(minotaurTicks > 0 ? minotaurTicks : 1)
+{
+    const Labyrinth& map = *this->labyrinth;
+    width = map.getWidth();
+    height = map.getHeight();
+
+    terrain.assign(static_cast<std::size_t>(width) * height, 0);
+    cellMask.assign(static_cast<std::size_t>(width) * height, 0);
+    for (uint32_t r = 0; r < height; r++) {
+        for (uint32_t c = 0; c < width; c++) {
+            terrain[r * width + c] = static_cast<uint8_t>(terrainCodeOf(map.getCell(r, c).getVal()));
+            if (!map.getMapGenerationSuccess()) {
+                continue;
+            }
+            // Only the hummer needs to know whether a neighbour lies on the border
+            const uint8_t inner = static_cast<uint8_t>(((r > 1) << Labyrinth::DIRECTION_UP) |
+                                                       ((r + 2 < height) << Labyrinth::DIRECTION_DOWN) |
+                                                       ((c > 1) << Labyrinth::DIRECTION_LEFT) |
+                                                       ((c + 2 < width) << Labyrinth::DIRECTION_RIGHT));
+            cellMask[r * width + c] = static_cast<uint8_t>(map.getOpenMask(r, c) | (inner << 4));
+        }
+    }
+
+    for (const Cell* cell : map.getPathFromEntranceToExit()) {
+        path.push_back(static_cast<uint32_t>(cell->getRow()) * width + cell->getCol());
+    }
+    const Cell start = map.getStartPoint();
+    const Cell exit = map.getEndPoint();
+    startCell = static_cast<uint32_t>(start.getRow() + 1) * width + start.getCol();
+    exitCell = static_cast<uint32_t>(exit.getRow()) * width + exit.getCol();
+
+    // Nobody steps back onto the entrance; the cell below it is the only one leading there
+    if (map.getMapGenerationSuccess()) {
+        cellMask[startCell] &= static_cast<uint8_t>(~(1u << Labyrinth::DIRECTION_UP));
+    }
+
+    // Same requirements as Game::spawn(), plus room for every item
+    ready = map.getMapGenerationSuccess() && path.size() >= 14 && map.getFloorCells().size() >= itemsPerGame + 2;
+
+    rngState.resize(games);
+    state.resize(games);
+    playerCell.resize(games);
+    minotaurCell.resize(games);
+    minotaurAlive.resize(games);
+    effects.resize(games);
+    turns.resize(games);
+    brokenCount.resize(games);
+    open.resize(games);
+    flags.resize(games);
+    picked.resize(games);
+    effectExpiry.resize(games * Player::EFFECT_COUNT);
+
+    const std::size_t slots = games * itemsPerGame;
+    itemCell.resize(slots);
+    itemKind.resize(slots);
+    itemState.resize(slots);
+    itemExpiry.resize(slots);
+    brokenWalls.resize(slots);
+
+    reset(seed);
+}
+
+// Same split as labyrinth-sim: neighbouring game indices get unrelated streams
+unsigned int GameBatch::gameSeed(unsigned int seed, std::size_t game)
+{
+    uint64_t z = (static_cast<uint64_t>(seed) << 32) + game + SplitMix64::GAMMA;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    const unsigned int mixed = static_cast<unsigned int>(z ^ (z >> 31));
+    return mixed != 0 ? mixed : 1;
+}
+
+void GameBatch::reset(unsigned int seed)
+{
+    tick = 0;
+    brokenPlanes = 0;
+    std::fill(itemState.begin(), itemState.end(), ITEM_NONE);
+    std::fill(effectExpiry.begin(), effectExpiry.end(), 0);
+    for (std::size_t game = 0; game < games; game++) {
+        rngState[game] = gameSeed(seed, game);
+        state[game] = ready ? Game::PLAYING : Game::QUIT;
+        minotaurAlive[game] = 1;
+        effects[game] = 0;
+        turns[game] = 0;
+        brokenCount[game] = 0;
+        if (ready) {
+            spawn(game);
+        }
+    }
+}
+
+/**
+ * @brief Places the player, the minotaur and the items of one game.
+ *
+ * @details Draws exactly as Game::spawn() does with one minotaur: the player below the entrance,
+ *          the minotaur on the path at least 7 cells from either end, then one pass of selection
+ *          sampling over the labyrinth's floor cells without the two occupied ones, each taken
+ *          item followed by the draw of its kind.
+ */
+void GameBatch::spawn(std::size_t game)
+{
+    uint64_t& rng = rngState[game];
+    const uint32_t player = startCell;
+    const uint32_t minotaur = path[7 + SplitMix64::next(rng) % static_cast<uint32_t>(path.size() - 13)];
+    playerCell[game] = player;
+    minotaurCell[game] = minotaur;
+
+    const std::vector<uint32_t>& candidates = labyrinth->getFloorCells();
+    uint32_t freeCount = 0;
+    for (uint32_t cell : candidates) {
+        freeCount += cell != player && cell != minotaur;
+    }
+
+    unsigned int needed = itemsPerGame;
+    for (std::size_t i = 0; i < candidates.size() && needed > 0; i++) {
+        const uint32_t cell = candidates[i];
+        if (cell == player || cell == minotaur) {
+            continue;
+        }
+        const bool take = SplitMix64::next(rng) % freeCount < needed;
+        freeCount--;
+        if (!take) {
+            continue;
+        }
+        const std::size_t slot = static_cast<std::size_t>(itemsPerGame - needed) * games + game;
+        needed--;
+        itemCell[slot] = cell;
+        itemKind[slot] = SplitMix64::next(rng) % 4;
+        itemState[slot] = ITEM_LYING;
+        itemExpiry[slot] = 0;
+    }
+}
+
+/**
+ * @brief Advances every game by one tick.
+ *
+ * @details Runs the phases of Game::step() in the same order, each over the whole batch.
+ */
+void GameBatch::step(const PlayerAction* actions)
+{
+    TRACE_SCOPE("GameBatch::step");
+    if (!ready) {
+        return;
+    }
+
+    applyActions(actions);
+    updateItemEffects();
+    if ((tick + 1) % minotaurTicks == 0) {
+        moveMinotaurs();
+    }
+    checkCollisions();
+    tick++;
+}
+
+// Bit of the direction from one cell to a neighbouring one, 0 if they are not neighbours.
+// Entities never stand on the border columns, so no neighbour can wrap around a row; the
+// comparisons are combined without branches.
+static inline uint32_t neighbourBit(uint32_t from, uint32_t to, uint32_t width)
+{
+    return static_cast<uint32_t>(to + width == from) << Labyrinth::DIRECTION_UP |
+           static_cast<uint32_t>(from + width == to) << Labyrinth::DIRECTION_DOWN |
+           static_cast<uint32_t>(to + 1 == from) << Labyrinth::DIRECTION_LEFT |
+           static_cast<uint32_t>(from + 1 == to) << Labyrinth::DIRECTION_RIGHT;
+}
+
+// One of two values, chosen with a mask rather than a jump: a ?: whose operands share their
+// conditions may be turned back into branches, and a branch keeps a loop from vectorizing
+static inline uint32_t choose(uint32_t condition, uint32_t ifTrue, uint32_t ifFalse)
+{
+    return ifFalse ^ ((ifTrue ^ ifFalse) & (0u - condition));
+}
+
+// One bit out of four without a variable shift, which has no vector form before AVX2
+static inline uint32_t bitOf(uint32_t index)
+{
+    return static_cast<uint32_t>(index == 0) | static_cast<uint32_t>(index == 1) << 1 |
+           static_cast<uint32_t>(index == 2) << 2 | static_cast<uint32_t>(index == 3) << 3;
+}
+
+// Each phase copies the count and the array pointers into locals, so nothing is reloaded from
+// the object inside its loops. Loops over more arrays than the compiler checks for overlap at
+// run time state with `GCC ivdep` that the arrays, all distinct members, do not overlap.
+
+// The mask is gathered from the cell of every game, the only loop that is not contiguous;
+// then one pass per plane of broken walls adds the walls next to the cell
+void GameBatch::gatherOpenDirections(const std::vector<uint32_t>& cells)
+{
+    const std::size_t count = games;
+    const uint32_t span = width;
+    const uint32_t* const at = cells.data();
+    const uint8_t* const masks = cellMask.data();
+    const uint32_t* const broken = brokenCount.data();
+    uint32_t* const directions = open.data();
+
+    for (std::size_t game = 0; game < count; game++) {
+        directions[game] = masks[at[game]];
+    }
+    for (unsigned int plane = 0; plane < brokenPlanes; plane++) {
+        const uint32_t* const walls = &brokenWalls[static_cast<std::size_t>(plane) * count];
+        for (std::size_t game = 0; game < count; game++) {
+            const uint32_t used = 0u - static_cast<uint32_t>(plane < broken[game]);
+            directions[game] = (directions[game] | (neighbourBit(at[game], walls[game], span) & used));
+        }
+    }
+}
+
+// Moves, attacks and quitting, as in Game::handleAction(); every game computes its target,
+// whether it moves, breaks a wall or kills the minotaur, and keeps or replaces each field
+void GameBatch::applyActions(const PlayerAction* actions)
+{
+    gatherOpenDirections(playerCell);
+
+    const std::size_t count = games;
+    const uint32_t span = width;
+    const uint32_t* const directions = open.data();
+    const uint32_t* const minotaur = minotaurCell.data();
+    uint32_t* const player = playerCell.data();
+    uint32_t* const moves = turns.data();
+    uint32_t* const status = state.data();
+    uint32_t* const active = effects.data();
+    uint32_t* const alive = minotaurAlive.data();
+    uint32_t* const breaking = flags.data();
+    uint32_t* const broken = brokenCount.data();
+
+    #pragma GCC ivdep
+    for (std::size_t game = 0; game < count; game++) {
+        const uint32_t action = static_cast<uint32_t>(actions[game]);
+        const uint32_t cell = player[game];
+        const uint32_t mask = directions[game];
+        const uint32_t effect = active[game];
+        const uint32_t living = alive[game];
+        const uint32_t current = status[game];
+        const uint32_t playing = current == Game::PLAYING;
+
+        const uint32_t direction = action - static_cast<uint32_t>(PlayerAction::UP);
+        const uint32_t isMove = playing & static_cast<uint32_t>(direction < Labyrinth::DIRECTION_COUNT);
+        const uint32_t bit = bitOf(direction);
+        const uint32_t target = choose(direction == Labyrinth::DIRECTION_UP, cell - span,
+                                choose(direction == Labyrinth::DIRECTION_DOWN, cell + span,
+                                choose(direction == Labyrinth::DIRECTION_LEFT, cell - 1, cell + 1)));
+
+        // The hummer breaks one wall, never the outer border
+        const uint32_t free = (mask & bit) != 0;
+        const uint32_t breaks = isMove & (free ^ 1u) & static_cast<uint32_t>((effect & EFFECT_HUMMER) != 0) &
+                                static_cast<uint32_t>(((mask >> 4) & bit) != 0);
+        const uint32_t go = isMove & (free | breaks);
+
+        // The sword reaches the 3x3 cells around the player: x is the minotaur's column
+        // offset + 1 in one of three consecutive rows
+        const uint32_t x = minotaur[game] - cell + span + 1;
+        const uint32_t adjacent = static_cast<uint32_t>(x < 3) | static_cast<uint32_t>(x - span < 3) | static_cast<uint32_t>(x - 2 * span < 3);
+        const uint32_t kills = playing & static_cast<uint32_t>(action == static_cast<uint32_t>(PlayerAction::ATTACK)) &
+                               static_cast<uint32_t>((effect & EFFECT_SWORD) != 0) & living & adjacent;
+        const uint32_t quits = playing & static_cast<uint32_t>(action == static_cast<uint32_t>(PlayerAction::QUIT));
+
+        player[game] = choose(go, target, cell);
+        moves[game] += go;
+        breaking[game] = (breaks);
+        alive[game] = (living & ~kills);
+        active[game] = (effect & ~(breaks * EFFECT_HUMMER | kills * EFFECT_SWORD));
+        status[game] = (choose(quits, Game::QUIT, current));
+    }
+
+    // The player now stands on the wall it broke
+    for (unsigned int plane = 0; plane < itemsPerGame; plane++) {
+        uint32_t* const walls = &brokenWalls[static_cast<std::size_t>(plane) * count];
+        for (std::size_t game = 0; game < count; game++) {
+            const uint32_t wall = walls[game];
+            const uint32_t cell = player[game];
+            walls[game] = choose(breaking[game] & static_cast<uint32_t>(broken[game] == plane), cell, wall);
+        }
+    }
+    uint32_t planes = brokenPlanes;
+    for (std::size_t game = 0; game < count; game++) {
+        const uint32_t walls = broken[game] + breaking[game];
+        broken[game] = walls;
+        planes = std::max(planes, walls);
+    }
+    brokenPlanes = planes;
+}
+
+// Effects and active items run out after a number of player moves, as the turn timers of
+// Game::advanceTurn() do. Every effect and item ends after the turn it started on, so
+// comparing with the turn count finds exactly those due on the move just made.
+void GameBatch::updateItemEffects()
+{
+    const std::size_t count = games;
+    const uint32_t* const moves = turns.data();
+    uint32_t* const active = effects.data();
+
+    for (unsigned int effect = 0; effect < Player::EFFECT_COUNT; effect++) {
+        const uint32_t* const expiry = &effectExpiry[static_cast<std::size_t>(effect) * count];
+        const uint32_t bit = 1u << effect;
+        for (std::size_t game = 0; game < count; game++) {
+            const uint32_t due = 0u - static_cast<uint32_t>(expiry[game] <= moves[game]);
+            active[game] = (active[game] & ~(bit & due));
+        }
+    }
+
+    for (unsigned int item = 0; item < itemsPerGame; item++) {
+        const uint32_t* const expiry = &itemExpiry[static_cast<std::size_t>(item) * count];
+        uint32_t* const items = &itemState[static_cast<std::size_t>(item) * count];
+        for (std::size_t game = 0; game < count; game++) {
+            const uint32_t current = items[game];
+            const uint32_t spent = static_cast<uint32_t>(current == ITEM_ACTIVE) & static_cast<uint32_t>(expiry[game] <= moves[game]);
+            items[game] = (choose(spent, ITEM_SPENT, current));
+        }
+    }
+}
+
+// Random moves avoiding walls and the exit, as in Game::minotaurMovementUpdate(): only games
+// whose minotaur can move advance their generator, and the n-th open direction is picked
+// from prefix counts of the mask
+void GameBatch::moveMinotaurs()
+{
+    gatherOpenDirections(minotaurCell);
+
+    const std::size_t count = games;
+    const uint32_t span = width;
+    const uint32_t exit = exitCell;
+    const uint32_t* const directions = open.data();
+    const uint32_t* const status = state.data();
+    const uint32_t* const alive = minotaurAlive.data();
+    uint32_t* const minotaur = minotaurCell.data();
+    uint64_t* const rngs = rngState.data();
+
+    for (std::size_t game = 0; game < count; game++) {
+        const uint32_t cell = minotaur[game];
+        const uint32_t mask = directions[game] & 0x0Fu & ~neighbourBit(cell, exit, span);
+        const uint32_t moves = static_cast<uint32_t>(status[game] == Game::PLAYING) & alive[game] & static_cast<uint32_t>(mask != 0);
+
+        const uint64_t rng = rngs[game] + (SplitMix64::GAMMA & (0ull - moves));
+        rngs[game] = rng;
+        const uint32_t random = SplitMix64::output(rng);
+
+        const uint32_t up = mask & 1u;
+        const uint32_t down = (mask >> 1) & 1u;
+        const uint32_t left = (mask >> 2) & 1u;
+        const uint32_t open = up + down + left + (mask >> 3);
+        const uint32_t n = choose(open == 4, random & 3u, choose(open == 2, random & 1u, choose(open == 3, random % 3u, 0)));
+        const uint32_t target = choose(up & static_cast<uint32_t>(n == 0), cell - span,
+                                choose(down & static_cast<uint32_t>(n == up), cell + span,
+                                choose(left & static_cast<uint32_t>(n == up + down), cell - 1, cell + 1)));
+
+        minotaur[game] = choose(moves, target, cell);
+    }
+}
+
+// Combat, the exit and items, as in Game::checkGameObjectCollision(): one pass decides the
+// fight and the exit, one pass per item plane picks up or destroys items and one pass per
+// effect plane starts the effects picked up
+void GameBatch::checkCollisions()
+{
+    const std::size_t count = games;
+    const uint32_t exit = exitCell;
+    const uint32_t* const player = playerCell.data();
+    const uint32_t* const minotaur = minotaurCell.data();
+    const uint32_t* const moves = turns.data();
+    const uint32_t* const alive = minotaurAlive.data();
+    uint32_t* const status = state.data();
+    uint32_t* const active = effects.data();
+    uint32_t* const checking = flags.data();
+    uint32_t* const kinds = picked.data();
+    uint32_t* const immunity = &effectExpiry[static_cast<std::size_t>(Player::EFFECT_IMMUNITY) * count];
+
+    #pragma GCC ivdep
+    for (std::size_t game = 0; game < count; game++) {
+        const uint32_t current = status[game];
+        const uint32_t effect = active[game];
+        const uint32_t cell = player[game];
+        const uint32_t playing = current == Game::PLAYING;
+        const uint32_t hit = playing & alive[game] & static_cast<uint32_t>(cell == minotaur[game]) &
+                             static_cast<uint32_t>((effect & EFFECT_IMMUNITY) == 0);
+        const uint32_t absorbs = hit & static_cast<uint32_t>((effect & EFFECT_SHIELD) != 0);
+        const uint32_t lost = hit & (absorbs ^ 1u);
+        const uint32_t won = playing & (lost ^ 1u) & static_cast<uint32_t>(cell == exit);
+
+        // Immunity is not active when the shield absorbs, so its end is simply replaced
+        const uint32_t ends = immunity[game];
+        immunity[game] = choose(absorbs, moves[game] + SHIELD_IMMUNITY, ends);
+        active[game] = (choose(absorbs, (effect & ~static_cast<uint32_t>(EFFECT_SHIELD)) | EFFECT_IMMUNITY, effect));
+        status[game] = (choose(lost, Game::PLAYER_LOST, choose(won, Game::PLAYER_WON, current)));
+        checking[game] = (playing & (lost ^ 1u) & (won ^ 1u));
+        kinds[game] = 0;
+    }
+
+    // Items lie on distinct cells, so a player picks up at most one per tick
+    for (unsigned int item = 0; item < itemsPerGame; item++) {
+        const std::size_t first = static_cast<std::size_t>(item) * count;
+        const uint32_t* const cells = &itemCell[first];
+        const uint32_t* const kind = &itemKind[first];
+        uint32_t* const items = &itemState[first];
+        uint32_t* const expiry = &itemExpiry[first];
+        #pragma GCC ivdep
+        for (std::size_t game = 0; game < count; game++) {
+            const uint32_t current = items[game];
+            const uint32_t cell = cells[game];
+            const uint32_t ends = expiry[game];
+            const uint32_t lying = checking[game] & static_cast<uint32_t>(current == ITEM_LYING);
+            const uint32_t picks = lying & static_cast<uint32_t>(cell == player[game]);
+            const uint32_t destroyed = lying & (picks ^ 1u) & alive[game] & static_cast<uint32_t>(cell == minotaur[game]);
+            items[game] = (choose(picks, ITEM_ACTIVE, choose(destroyed, ITEM_SPENT, current)));
+            expiry[game] = choose(picks, moves[game] + ITEM_EFFECT_DURATION, ends);
+            kinds[game] = (kinds[game] | (bitOf(kind[game]) & (0u - picks)));
+        }
+    }
+
+    // As Player::addEffect(): an effect that is already active keeps the later end
+    for (unsigned int effect = 0; effect <= static_cast<unsigned int>(ItemKind::SWORD); effect++) {
+        uint32_t* const expiry = &effectExpiry[static_cast<std::size_t>(effect) * count];
+        const uint32_t bit = 1u << effect;
+        for (std::size_t game = 0; game < count; game++) {
+            const uint32_t ends = expiry[game];
+            const uint32_t mask = active[game];
+            const uint32_t starting = kinds[game] & bit;
+            const uint32_t expiresAt = moves[game] + ITEM_EFFECT_DURATION;
+            const uint32_t starts = static_cast<uint32_t>(starting != 0) &
+                                    (static_cast<uint32_t>((mask & bit) == 0) | static_cast<uint32_t>(expiresAt > ends));
+            expiry[game] = choose(starts, expiresAt, ends);
+            active[game] = (mask | starting);
+        }
+    }
+}
+
+std::size_t GameBatch::countFinished() const
+{
+    std::size_t finished = 0;
+    for (std::size_t game = 0; game < games; game++) {
+        finished += state[game] != Game::PLAYING;
+    }
+    return finished;
+}
+
+void GameBatch::observe(std::size_t game, int radius, uint8_t* out) const
+{
+    const int side = 2 * radius + 1;
+    const std::size_t plane = static_cast<std::size_t>(side) * side;
+    std::memset(out, 0, OBSERVATION_CHANNELS * plane); // OUTSIDE, no entities
+
+    const int top = getPlayerRow(game) - radius;
+    const int left = getPlayerCol(game) - radius;
+    const int firstCol = std::max(left, 0);
+    const int lastCol = std::min(left + side, static_cast<int>(width));
+
+    uint8_t* terrainOut = out + CHANNEL_TERRAIN * plane;
+    if (firstCol < lastCol) {
+        for (int wr = 0; wr < side; wr++) {
+            const int row = top + wr;
+            if (row >= 0 && row < static_cast<int>(height)) {
+                std::memcpy(terrainOut + wr * side + (firstCol - left),
+                            &terrain[static_cast<std::size_t>(row) * width + firstCol],
+                            static_cast<std::size_t>(lastCol - firstCol));
+            }
+        }
+    }
+
+    auto windowIndex = [&](uint32_t cell) -> int {
+        const int wr = static_cast<int>(cell / width) - top;
+        const int wc = static_cast<int>(cell % width) - left;
+        return (wr >= 0 && wr < side && wc >= 0 && wc < side) ? wr * side + wc : -1;
+    };
+
+    for (unsigned int i = 0; i < brokenCount[game]; i++) {
+        const int index = windowIndex(brokenWalls[static_cast<std::size_t>(i) * games + game]);
+        if (index >= 0) {
+            terrainOut[index] = static_cast<uint8_t>(TerrainCode::FLOOR);
+        }
+    }
+    if (minotaurAlive[game]) {
+        const int index = windowIndex(minotaurCell[game]);
+        if (index >= 0) {
+            out[CHANNEL_MINOTAUR * plane + index] = 1;
+        }
+    }
+    for (unsigned int i = 0; i < itemsPerGame; i++) {
+        const std::size_t slot = static_cast<std::size_t>(i) * games + game;
+        if (itemState[slot] == ITEM_LYING) {
+            const int index = windowIndex(itemCell[slot]);
+            if (index >= 0) {
+                out[CHANNEL_ITEMS * plane + index] = static_cast<uint8_t>(itemKind[slot] + 1);
+            }
+        }
+    }
+}
+
+void GameBatch::observe(int radius, uint8_t* out) const
+{
+    const std::size_t stride = observationSize(radius);
+    for (std::size_t game = 0; game < games; game++) {
+        observe(game, radius, out + game * stride);
+    }
+}
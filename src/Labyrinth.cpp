@@ -1,6 +1,8 @@
 #include "Labyrinth.h"
 #include "Cell.h"
+#include "Trace.h"
 #include <iostream>
+#include <algorithm>
 #include <vector>
 #include <queue>
 #include <cmath>
@@ -10,19 +12,61 @@
 #include <list>
 #include <termcolor.hpp>
 #include <chrono>
+#include <random>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 // Returns an integer in [0..max-1]
-static int randomInt(int max) {
+static int randomInt(std::mt19937& rng, int max) {
     if (max <= 0) return 0;
-    return rand() % max;
+    return static_cast<int>(rng() % static_cast<unsigned int>(max));
 }
 
 // Returns 1 (true) with probability p, else 0 (false)
-static int randomBool(double p) {
-    double r = (double)rand() / RAND_MAX;
+static int randomBool(std::mt19937& rng, double p) {
+    double r = static_cast<double>(rng()) / std::mt19937::max();
     return (r < p) ? 1 : 0;
 }
 
+// Nanoseconds elapsed since `start`
+static uint64_t elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+static const char BINARY_MAGIC[4] = {'L', 'B', 'Y', 'B'};
+
+// 32-bit FNV-1a, continued from `hash`
+static uint32_t fnv1a(const unsigned char* data, std::size_t size, uint32_t hash = 2166136261u) {
+    for (std::size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void writeVarint(std::vector<unsigned char>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+// Returns false if the varint runs past `end` or does not fit into 32 bits
+static bool readVarint(const unsigned char*& p, const unsigned char* end, uint32_t& value) {
+    value = 0;
+    for (unsigned int shift = 0; shift < 35; shift += 7) {
+        if (p == end) return false;
+        unsigned char byte = *p++;
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
 /**
  * @brief Constructs a Labyrinth object with the specified width and height.
  * 
@@ -34,28 +78,52 @@ static int randomBool(double p) {
  * If successful, it finds a path from the entrance to the exit.
  */
 Labyrinth::Labyrinth(unsigned int w, unsigned int h)
-    : width(w), height(h), quietMode(false)
+    : Labyrinth(w, h, false)
 {
-    srand(static_cast<unsigned>(time(nullptr)));
+}
 
+/**
+ * @brief Constructs a Labyrinth object with the specified width, height, and quiet mode.
+ * 
+ * @param w The width of the labyrinth.
+ * @param h The height of the labyrinth.
+ * @param quiet If true, enables quiet mode (suppressing output messages).
+ * 
+ * @details 
+ * Uses a fresh random seed; see getSeed() to reproduce the map.
+ */
+Labyrinth::Labyrinth(unsigned int w, unsigned int h, bool quiet)
+    : Labyrinth(w, h, quiet, std::random_device{}())
+{
+}
+
+/**
+ * @brief Constructs a Labyrinth object generated from a given seed.
+ * 
+ * @param w The width of the labyrinth.
+ * @param h The height of the labyrinth.
+ * @param quiet If true, enables quiet mode (suppressing output messages).
+ * @param seed Seed of the labyrinth's own random generator.
+ * 
+ * @details 
+ * Initializes the labyrinth grid, sets all cells to walls ('#'), and attempts to generate a valid map.
+ * If successful, it finds a path from the entrance to the exit. The same seed and dimensions always
+ * produce the same map; no global random state is used.
+ */
+Labyrinth::Labyrinth(unsigned int w, unsigned int h, bool quiet, unsigned int seed)
+    : width(w), height(h), quietMode(quiet), seed(seed), rng(seed)
+{
     if (!quietMode) {
         std::cout << "Memory allocation for labyrinth "
                   << width << " x " << height << "...\n";
     }
 
-    labyrinth = new Cell*[height];
-    for (unsigned int row = 0; row < height; row++) {
-        labyrinth[row] = new Cell[width];
-        for (unsigned int col = 0; col < width; col++) {
-            // By default, set everything to '#'
-            labyrinth[row][col] = Cell(row, col, '#');
-        }
-    }
+    allocateGrid();
 
     if (!quietMode) {
         std::cout << "Memory allocated.\n";
     }
-    
+
     // Measure labyrinth generation time
     auto start = std::chrono::high_resolution_clock::now();
     mapGeneratedSuccessfully = generate();
@@ -68,62 +136,340 @@ Labyrinth::Labyrinth(unsigned int w, unsigned int h)
 }
 
 /**
- * @brief Constructs a Labyrinth object with the specified width, height, and quiet mode.
+ * @brief Destructor for the Labyrinth class.
  * 
- * @param w The width of the labyrinth.
- * @param h The height of the labyrinth.
+ * @details 
+ * Deallocates the dynamically allocated labyrinth grid.
+ */
+Labyrinth::~Labyrinth()
+{
+    if (labyrinth) {
+        delete[] labyrinth[0];  // The contiguous cell block
+        delete[] labyrinth;     // Row pointers
+    }
+}
+
+/**
+ * @brief Loads a labyrinth previously written with saveToFile().
+ * 
+ * @param filename Path of the saved labyrinth.
  * @param quiet If true, enables quiet mode (suppressing output messages).
  * 
  * @details 
- * Initializes the labyrinth grid, sets all cells to walls ('#'), and attempts to generate a valid map.
- * If successful, it finds a path from the entrance to the exit.
+ * Maps the file into memory and parses the rows directly from the mapping, avoiding
+ * stream reads and per-line string copies. The path from 'U' to 'I' is recomputed with BFS.
  */
-Labyrinth::Labyrinth(unsigned int w, unsigned int h, bool quiet)
-    : width(w), height(h), quietMode(quiet)
+Labyrinth::Labyrinth(const std::string& filename, bool quiet)
+    : width(0), height(0), quietMode(quiet)
 {
-    srand(static_cast<unsigned>(time(nullptr)));
+    auto start = std::chrono::high_resolution_clock::now();
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (!quietMode) {
+            std::cout << termcolor::red << "Unable to open labyrinth file " << filename << ".\n" << termcolor::reset;
+        }
+        return;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        if (!quietMode) {
+            std::cout << termcolor::red << "Labyrinth file " << filename << " is empty.\n" << termcolor::reset;
+        }
+        return;
+    }
+
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping stays valid after the descriptor is closed
+
+    if (mapping == MAP_FAILED) {
+        if (!quietMode) {
+            std::cout << termcolor::red << "Unable to map labyrinth file " << filename << ".\n" << termcolor::reset;
+        }
+        return;
+    }
+    madvise(mapping, size, MADV_SEQUENTIAL);
+
+    uint32_t expectedPathLength = 0; // Only known for binary files
+    bool parsed = (size >= 4 && std::memcmp(mapping, BINARY_MAGIC, 4) == 0)
+        ? parseBinary(static_cast<const unsigned char*>(mapping), size, expectedPathLength)
+        : parseText(static_cast<const char*>(mapping), size);
+    munmap(mapping, size);
+
+    if (parsed) {
+        computeOpenMasks();
+        pathFromEntranceToExit = findPathFromEntranceToExit();
+        indexFloorCells();
+        mapGeneratedSuccessfully = !pathFromEntranceToExit.empty() &&
+            (expectedPathLength == 0 || pathFromEntranceToExit.size() == expectedPathLength);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    generation_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
     if (!quietMode) {
-        std::cout << "Memory allocation for labyrinth "
-                  << width << " x " << height << "...\n";
+        if (mapGeneratedSuccessfully) {
+            std::cout << termcolor::green << "Labyrinth " << width << " x " << height
+                      << " loaded from " << filename << ".\n" << termcolor::reset;
+        } else {
+            std::cout << termcolor::red << "Labyrinth file " << filename << " is not a valid labyrinth.\n" << termcolor::reset;
+        }
     }
+}
 
+void Labyrinth::allocateGrid()
+{
     labyrinth = new Cell*[height];
+    Cell* cells = new Cell[static_cast<std::size_t>(height) * width];
     for (unsigned int row = 0; row < height; row++) {
-        labyrinth[row] = new Cell[width];
+        labyrinth[row] = cells + static_cast<std::size_t>(row) * width;
         for (unsigned int col = 0; col < width; col++) {
             // By default, set everything to '#'
             labyrinth[row][col] = Cell(row, col, '#');
         }
     }
+}
 
-    if (!quietMode) {
-        std::cout << "Memory allocated.\n";
+// Bit d of a cell's mask is set if its neighbour in Direction d exists and is not a wall
+void Labyrinth::computeOpenMasks()
+{
+    openMasks.assign(static_cast<std::size_t>(width) * height, 0);
+    for (unsigned int r = 0; r < height; r++) {
+        for (unsigned int c = 0; c < width; c++) {
+            uint8_t mask = 0;
+            if (r > 0 && labyrinth[r - 1][c].getVal() != '#') mask |= 1u << DIRECTION_UP;
+            if (r + 1 < height && labyrinth[r + 1][c].getVal() != '#') mask |= 1u << DIRECTION_DOWN;
+            if (c > 0 && labyrinth[r][c - 1].getVal() != '#') mask |= 1u << DIRECTION_LEFT;
+            if (c + 1 < width && labyrinth[r][c + 1].getVal() != '#') mask |= 1u << DIRECTION_RIGHT;
+            openMasks[static_cast<std::size_t>(r) * width + c] = mask;
+        }
     }
+}
 
-    // Measure labyrinth generation time
-    auto start = std::chrono::high_resolution_clock::now();
-    mapGeneratedSuccessfully = generate();
-    auto end = std::chrono::high_resolution_clock::now();
-    generation_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-    
-    if (mapGeneratedSuccessfully) {
-        pathFromEntranceToExit = findPathFromEntranceToExit();
+// Only the neighbours see a change of the cell: each one flips the bit pointing back at it
+void Labyrinth::updateOpenMasks(unsigned int row, unsigned int col)
+{
+    if (openMasks.empty()) {
+        return;
+    }
+    const bool open = labyrinth[row][col].getVal() != '#';
+    for (unsigned int d = 0; d < DIRECTION_COUNT; d++) {
+        const int r = static_cast<int>(row) + DIRECTION_ROW[d];
+        const int c = static_cast<int>(col) + DIRECTION_COL[d];
+        if (r < 0 || r >= static_cast<int>(height) || c < 0 || c >= static_cast<int>(width)) {
+            continue;
+        }
+        uint8_t& mask = openMasks[static_cast<std::size_t>(r) * width + c];
+        const uint8_t back = static_cast<uint8_t>(1u << (d ^ 1));
+        mask = open ? static_cast<uint8_t>(mask | back) : static_cast<uint8_t>(mask & ~back);
     }
 }
 
-/**
- * @brief Destructor for the Labyrinth class.
- * 
- * @details 
- * Deallocates the dynamically allocated labyrinth grid.
- */
-Labyrinth::~Labyrinth()
+// Breadth-first search over the open masks from the player's start; the entrance and the
+// exit are walked through but only empty cells are listed
+void Labyrinth::indexFloorCells()
 {
-    for (unsigned int r = 0; r < height; r++) {
-        delete[] labyrinth[r];
+    floorCells.clear();
+    reachableFloorCells.clear();
+    floorIndexed = !openMasks.empty();
+    if (!floorIndexed) {
+        return;
     }
-    delete[] labyrinth;
+
+    for (uint32_t cell = 0; cell < width * height; cell++) {
+        if (labyrinth[cell / width][cell % width].getVal() == ' ') {
+            floorCells.push_back(cell);
+        }
+    }
+
+    if (startPoint.getRow() < 0 || startPoint.getRow() + 1 >= static_cast<int>(height) ||
+        startPoint.getCol() < 0 || startPoint.getCol() >= static_cast<int>(width)) {
+        return;
+    }
+    const uint32_t start = static_cast<uint32_t>(startPoint.getRow() + 1) * width + static_cast<uint32_t>(startPoint.getCol());
+    std::vector<uint8_t> seen(static_cast<std::size_t>(width) * height, 0);
+    std::vector<uint32_t> queue{ start };
+    seen[start] = 1;
+    const int32_t offsets[DIRECTION_COUNT] = { -static_cast<int32_t>(width), static_cast<int32_t>(width), -1, 1 };
+    for (std::size_t head = 0; head < queue.size(); head++) {
+        const uint32_t cell = queue[head];
+        if (labyrinth[cell / width][cell % width].getVal() == ' ') {
+            reachableFloorCells.push_back(cell);
+        }
+        for (unsigned int d = 0; d < DIRECTION_COUNT; d++) {
+            const uint32_t next = cell + offsets[d];
+            if ((openMasks[cell] & (1u << d)) && !seen[next]) {
+                seen[next] = 1;
+                queue.push_back(next);
+            }
+        }
+    }
+    std::sort(reachableFloorCells.begin(), reachableFloorCells.end());
+}
+
+//------------------------------------------------------------------------------
+// Text format written by saveToFile(): one line per row, one character per cell.
+// The first line defines the width; every other line must have the same length
+// (a trailing '\r' from Windows line endings is ignored).
+//------------------------------------------------------------------------------
+bool Labyrinth::parseText(const char* data, std::size_t size)
+{
+    const char* const endOfData = data + size;
+
+    // First pass: measure the rows without copying anything
+    unsigned int rows = 0;
+    std::size_t rowLength = 0;
+    for (const char* p = data; p < endOfData; ) {
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', endOfData - p));
+        const char* lineEnd = eol ? eol : endOfData;
+        std::size_t length = lineEnd - p;
+        if (length > 0 && p[length - 1] == '\r') {
+            length--;
+        }
+
+        if (length > 0) {
+            if (rows == 0) {
+                rowLength = length;
+            } else if (length != rowLength) {
+                return false; // Not a rectangle
+            }
+            rows++;
+        }
+        p = eol ? eol + 1 : endOfData;
+    }
+
+    if (rows < 3 || rowLength < 3) {
+        return false;
+    }
+
+    width = static_cast<unsigned int>(rowLength);
+    height = rows;
+    allocateGrid();
+
+    // Second pass: copy the cells straight from the mapping
+    unsigned int entrances = 0;
+    unsigned int exits = 0;
+    unsigned int row = 0;
+    for (const char* p = data; p < endOfData && row < height; ) {
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', endOfData - p));
+        const char* lineEnd = eol ? eol : endOfData;
+        if (lineEnd - p >= static_cast<std::ptrdiff_t>(width)) {
+            Cell* cells = labyrinth[row];
+            for (unsigned int col = 0; col < width; col++) {
+                char val = p[col];
+                switch (val) {
+                    case 'U':
+                        entrances++;
+                        startPoint = Cell(row, col, 'U');
+                        break;
+                    case 'I':
+                        exits++;
+                        endPoint = Cell(row, col, 'I');
+                        break;
+                    case '#':
+                    case ' ':
+                        break;
+                    case 'R':
+                    case 'M':
+                    case 'P':
+                        val = ' '; // Saved game objects are not part of the map
+                        break;
+                    default:
+                        return false;
+                }
+                cells[col].setVal(val);
+            }
+            row++;
+        }
+        p = eol ? eol + 1 : endOfData;
+    }
+
+    return entrances == 1 && exits == 1 &&
+           startPoint.getRow() == 0 && endPoint.getRow() == static_cast<int>(height) - 1;
+}
+
+//------------------------------------------------------------------------------
+// Binary format written by saveToBinaryFile(): a LabyrinthFileHeader followed by
+// the wall plane. 'U' and 'I' are stored as floor bits and restored from the header.
+//------------------------------------------------------------------------------
+bool Labyrinth::parseBinary(const unsigned char* data, std::size_t size, uint32_t& pathLength)
+{
+    LabyrinthFileHeader header;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.version != LabyrinthFileHeader::VERSION ||
+        (header.flags & ~LabyrinthFileHeader::FLAG_RUN_LENGTH) != 0 ||
+        header.payloadSize != size - sizeof(header) ||
+        header.width < 3 || header.height < 3 ||
+        header.width > 65536 || header.height > 65536) {
+        return false;
+    }
+
+    const uint32_t storedChecksum = header.checksum;
+    header.checksum = 0;
+    uint32_t checksum = fnv1a(reinterpret_cast<const unsigned char*>(&header), sizeof(header));
+    checksum = fnv1a(data + sizeof(header), header.payloadSize, checksum);
+    if (checksum != storedChecksum) {
+        return false;
+    }
+
+    if (header.startRow != 0 || header.startCol >= header.width ||
+        header.endRow != header.height - 1 || header.endCol >= header.width) {
+        return false;
+    }
+
+    const unsigned char* p = data + sizeof(header);
+    const unsigned char* const end = p + header.payloadSize;
+    const std::size_t rowBytes = (header.width + 7) / 8;
+    const bool runLength = (header.flags & LabyrinthFileHeader::FLAG_RUN_LENGTH) != 0;
+
+    if (!runLength && header.payloadSize != rowBytes * header.height) {
+        return false;
+    }
+
+    width = header.width;
+    height = header.height;
+    seed = header.seed;
+    allocateGrid();
+
+    for (unsigned int row = 0; row < height; row++) {
+        Cell* cells = labyrinth[row];
+        if (runLength) {
+            unsigned int col = 0;
+            bool wall = false;
+            while (col < width) {
+                uint32_t run;
+                if (!readVarint(p, end, run) || run > width - col) {
+                    return false;
+                }
+                for (uint32_t i = 0; i < run; i++) {
+                    cells[col++].setVal(wall ? '#' : ' ');
+                }
+                wall = !wall;
+            }
+        } else {
+            for (unsigned int col = 0; col < width; col++) {
+                cells[col].setVal(((p[col >> 3] >> (col & 7)) & 1) ? '#' : ' ');
+            }
+            p += rowBytes;
+        }
+    }
+    if (p != end) {
+        return false;
+    }
+
+    startPoint = Cell(header.startRow, header.startCol, 'U');
+    endPoint = Cell(header.endRow, header.endCol, 'I');
+    labyrinth[header.startRow][header.startCol].setVal('U');
+    labyrinth[header.endRow][header.endCol].setVal('I');
+    pathLength = header.pathLength;
+    return true;
 }
 
 //------------------------------------------------------------------------------
@@ -195,37 +541,53 @@ void Labyrinth::createSemicircle(unsigned int centerRow, unsigned int centerCol,
 // BFS: is there a path from (sr,sc) to (er,ec)?
 //
 bool Labyrinth::isPathExists(unsigned int sr, unsigned int sc,
-                             unsigned int er, unsigned int ec)
+                             unsigned int er, unsigned int ec,
+                             GenerationStats* stats)
 {
+    TRACE_SCOPE("Labyrinth::isPathExists");
+
     std::queue<std::pair<int,int>> q;
     std::vector<std::vector<bool>> visited(height, std::vector<bool>(width, false));
 
     q.push({ static_cast<int>(sr), static_cast<int>(sc) });
     visited[sr][sc] = true;
 
-    const int DR[4] = { -1, 1,  0, 0 };
-    const int DC[4] = {  0, 0, -1, 1 };
+    uint64_t cellsVisited = 0;
+    std::size_t peakQueue = 1;
+
+    // Reports the work done so far, whichever way the search ends
+    auto report = [&]() {
+        if (stats) {
+            stats->bfsCellsVisited += cellsVisited;
+            std::size_t scratch = height * (sizeof(std::vector<bool>) + (width + 7) / 8) +
+                                  peakQueue * sizeof(std::pair<int,int>);
+            stats->peakScratchBytes = std::max(stats->peakScratchBytes, scratch);
+        }
+    };
 
     while (!q.empty()) {
         auto [r, c] = q.front();
         q.pop();
+        cellsVisited++;
 
         if ((unsigned int)r == er && (unsigned int)c == ec) {
+            report();
             return true;
         }
+        // The mask already excludes walls and cells outside the grid
+        const uint8_t open = openMasks[static_cast<std::size_t>(r) * width + c];
         for (int i = 0; i < 4; i++) {
-            int nr = r + DR[i];
-            int nc = c + DC[i];
-            if (nr >= 0 && nr < (int)height &&
-                nc >= 0 && nc < (int)width &&
-                !visited[nr][nc] &&
-                labyrinth[nr][nc].getVal() != '#')
+            int nr = r + DIRECTION_ROW[i];
+            int nc = c + DIRECTION_COL[i];
+            if ((open & (1u << i)) && !visited[nr][nc])
             {
                 visited[nr][nc] = true;
                 q.push({ nr, nc });
             }
         }
+        peakQueue = std::max(peakQueue, q.size());
     }
+    report();
     return false;
 }
 
@@ -252,23 +614,33 @@ bool Labyrinth::wallCondition()
 //
 bool Labyrinth::generate()
 {
+    TRACE_SCOPE("Labyrinth::generate");
+
     const unsigned int MAX_ATTEMPTS = 100;
     bool success = false;
 
+    generationStats = GenerationStats();
+    const auto generationStart = std::chrono::steady_clock::now();
+
     for (unsigned int attempt = 1; attempt <= MAX_ATTEMPTS && !success; attempt++)
     {
+        TRACE_SCOPE("generate.attempt");
+        generationStats.attempts = attempt;
+        auto phaseStart = std::chrono::steady_clock::now();
+
         // Reset labyrinth to '#'
         for (unsigned int r = 0; r < height; r++) {
             for (unsigned int c = 0; c < width; c++) {
                 labyrinth[r][c].setVal('#');
             }
         }
+        generationStats.resetNs += elapsedNs(phaseStart);
 
         // Set 'U' and 'I' at random columns
-        unsigned int enterCol = 1 + randomInt(width / 2 - 1);
+        unsigned int enterCol = 1 + randomInt(rng, width / 2 - 1);
         labyrinth[0][enterCol].setVal('U');
 
-        unsigned int exitCol = width / 2 + randomInt(width / 2 - 1);
+        unsigned int exitCol = width / 2 + randomInt(rng, width / 2 - 1);
         labyrinth[height - 1][exitCol].setVal('I');
 
         // Set start point as the cell below 'U'
@@ -276,11 +648,16 @@ bool Labyrinth::generate()
         this->endPoint = labyrinth[height - 1][exitCol];
 
         // 1) Eller's-like generation in [1..height-2][1..width-2]
+        phaseStart = std::chrono::steady_clock::now();
         {
             unsigned int innerRows = height - 2;
             unsigned int innerCols = width - 2;
             std::vector<int> currentSet(innerCols, 0), nextSet(innerCols, 0);
 
+            // Both set rows plus the per-row hasDown flags
+            generationStats.peakScratchBytes = std::max(generationStats.peakScratchBytes,
+                2 * innerCols * sizeof(int) + (innerCols + 7) / 8);
+
             int uniqueSetId = 1;
 
             auto mergeSets = [&](std::vector<int>& rowSet, int fromId, int toId) {
@@ -302,7 +679,7 @@ bool Labyrinth::generate()
             // Initialize row = 1
             for (unsigned int c = 0; c < innerCols; c++) {
                 currentSet[c] = uniqueSetId++;
-                if (randomBool(0.3)) {
+                if (randomBool(rng, 0.3)) {
                     carveInner(1, c + 1);
                 }
             }
@@ -312,7 +689,7 @@ bool Labyrinth::generate()
                 // Horizontal merges
                 for (unsigned int c = 0; c < innerCols - 1; c++) {
                     if (currentSet[c] != currentSet[c+1]) {
-                        if (randomBool(0.55)) {
+                        if (randomBool(rng, 0.55)) {
                             int oldSet = currentSet[c+1];
                             int newSet = currentSet[c];
                             mergeSets(currentSet, oldSet, newSet);
@@ -329,7 +706,7 @@ bool Labyrinth::generate()
 
                 // Random vertical pass
                 for (unsigned int c = 0; c < innerCols; c++) {
-                    if (randomBool(0.5)) {
+                    if (randomBool(rng, 0.5)) {
                         carveInner(row + 1, c + 1);
                         nextSet[c] = currentSet[c];
                         hasDown[c] = true;
@@ -373,7 +750,7 @@ bool Labyrinth::generate()
                     int newSet = currentSet[c];
                     mergeSets(currentSet, oldSet, newSet);
                     // partial horizontal carve
-                    if (randomBool(0.5)) {
+                    if (randomBool(rng, 0.5)) {
                         carveInner(lastInnerRow, c + 1);
                         carveInner(lastInnerRow, c + 2);
                     }
@@ -381,8 +758,10 @@ bool Labyrinth::generate()
             }
 
         }
+        generationStats.ellerNs += elapsedNs(phaseStart);
 
         // 2) Now carve semicircles around 'U' and 'I'
+        phaseStart = std::chrono::steady_clock::now();
         {
             // Experimentally set radius to 1/12.5 of the minimum dimension
             unsigned int semiRadius = std::min(height, width) / 12.5;
@@ -397,6 +776,7 @@ bool Labyrinth::generate()
                 createSemicircle(height - 2, exitCol, semiRadius, false);
             }
         }
+        generationStats.semicircleNs += elapsedNs(phaseStart);
 
         // 3) BFS from (1, enterCol) to (height-2, exitCol)
         unsigned int startRow = 1;
@@ -404,7 +784,13 @@ bool Labyrinth::generate()
         unsigned int endRow = height - 2;
         unsigned int endCol = exitCol;
 
-        if (!isPathExists(startRow, startCol, endRow, endCol)) {
+        phaseStart = std::chrono::steady_clock::now();
+        computeOpenMasks();
+        bool pathExists = isPathExists(startRow, startCol, endRow, endCol, &generationStats);
+        generationStats.pathCheckNs += elapsedNs(phaseStart);
+
+        if (!pathExists) {
+            generationStats.noPathFailures++;
             if (!quietMode) {
                 std::cout << "No path from U to I on attempt "
                           << attempt << " / " << MAX_ATTEMPTS << ". Retrying...\n";
@@ -416,7 +802,12 @@ bool Labyrinth::generate()
             }
             success = true;
 
-            if (!wallCondition()) {
+            phaseStart = std::chrono::steady_clock::now();
+            bool enoughWalls = wallCondition();
+            generationStats.wallConditionNs += elapsedNs(phaseStart);
+
+            if (!enoughWalls) {
+                generationStats.wallConditionFailures++;
                 if (!quietMode) {
                     std::cout << "Wall condition not met, retrying...\n";
                 }
@@ -446,15 +837,48 @@ bool Labyrinth::generate()
     // I needed to be sure that the path is guaranteed,
     // so I made another BFS function for that.
     //
+    const auto findPathStart = std::chrono::steady_clock::now();
     this->pathFromEntranceToExit = this->findPathFromEntranceToExit();
+    generationStats.findPathNs = elapsedNs(findPathStart);
+    indexFloorCells();
+    generationStats.totalNs = elapsedNs(generationStart);
     return success;
 }
 
-void Labyrinth::print()
+void Labyrinth::print() const
 {
+    TRACE_SCOPE("Labyrinth::print");
+    printRows(nullptr, nullptr);
+}
+
+void Labyrinth::print(const std::string& frame) const
+{
+    TRACE_SCOPE("Labyrinth::print");
+    printRows(frame.size() == static_cast<std::size_t>(width) * height ? frame.data() : nullptr, nullptr);
+}
+
+/**
+ * @brief Prints the grid, or a frame composed over it, with the colours of each symbol.
+ * 
+ * @param frame Row-major symbols of every cell, or nullptr to print the grid itself.
+ * @param fogCenter If not null, only the 3x3 area around it and the border are shown.
+ */
+void Labyrinth::printRows(const char* frame, const Cell* fogCenter) const
+{
+    const int fogRadius = 1;
     for (unsigned int r = 0; r < height; r++) {
         for (unsigned int c = 0; c < width; c++) {
-            switch (labyrinth[r][c].getVal())
+            if (fogCenter &&
+                !(std::abs((int)r - (int)fogCenter->getRow()) <= fogRadius &&
+                  std::abs((int)c - (int)fogCenter->getCol()) <= fogRadius) &&
+                r != 0 && r != height - 1 && c != 0 && c != width - 1)
+            {
+                std::cout << ' ';
+                continue;
+            }
+
+            const char val = frame ? frame[static_cast<std::size_t>(r) * width + c] : labyrinth[r][c].getVal();
+            switch (val)
             {
             case 'U':
                 std::cout << termcolor::green << 'U' << termcolor::reset;
@@ -471,11 +895,23 @@ void Labyrinth::print()
             case 'M':
                 std::cout << termcolor::on_bright_red << 'M' << termcolor::reset;
                 break;
+            case '#':
+                if (boxDrawing && !openMasks.empty()) {
+                    // Neighbours inside the grid that are not open are walls as well
+                    uint8_t inside = 0;
+                    if (r > 0) inside |= 1u << DIRECTION_UP;
+                    if (r + 1 < height) inside |= 1u << DIRECTION_DOWN;
+                    if (c > 0) inside |= 1u << DIRECTION_LEFT;
+                    if (c + 1 < width) inside |= 1u << DIRECTION_RIGHT;
+                    std::cout << wallGlyph(static_cast<uint8_t>(inside & ~getOpenMask(r, c)));
+                } else {
+                    std::cout << '#';
+                }
+                break;
             default:
-                std::cout << labyrinth[r][c];
+                std::cout << val;
                 break;
             }
-            
         }
         std::cout << "\n";
     }
@@ -495,47 +931,92 @@ void Labyrinth::saveToFile(const std::string& filename)
     }
 }
 
-void Labyrinth::printWithFogOfWar(const Cell& playerPos)
-{       
-    int fogRadius = 1;
+/**
+ * @brief Saves the static map to a compact binary file.
+ * 
+ * @details 
+ * The whole file is assembled in memory and written with a single write. Only walls
+ * are stored; everything else ('U', 'I', game objects) is written as floor.
+ */
+bool Labyrinth::saveToBinaryFile(const std::string& filename, bool runLengthEncoded)
+{
+    LabyrinthFileHeader header;
+    std::memcpy(header.magic, BINARY_MAGIC, 4);
+    header.version = LabyrinthFileHeader::VERSION;
+    header.flags = runLengthEncoded ? LabyrinthFileHeader::FLAG_RUN_LENGTH : 0;
+    header.width = width;
+    header.height = height;
+    header.seed = seed;
+    header.startRow = startPoint.getRow();
+    header.startCol = startPoint.getCol();
+    header.endRow = endPoint.getRow();
+    header.endCol = endPoint.getCol();
+    header.pathLength = static_cast<uint32_t>(pathFromEntranceToExit.size());
+    header.payloadSize = 0;
+    header.checksum = 0;
+
+    const std::size_t rowBytes = (width + 7) / 8;
+    std::vector<unsigned char> buffer(sizeof(header));
+    buffer.reserve(sizeof(header) + rowBytes * height);
+
     for (unsigned int r = 0; r < height; r++) {
-        for (unsigned int c = 0; c < width; c++) {
-            if (std::abs((int)r - (int)playerPos.getRow()) <= fogRadius &&
-                std::abs((int)c - (int)playerPos.getCol()) <= fogRadius || r == 0 || r == height - 1 || c == 0 || c == width - 1)
-            {
-                switch (labyrinth[r][c].getVal())
-                {
-                case 'U':
-                    std::cout << termcolor::green << 'U' << termcolor::reset;
-                    break;
-                case 'I':
-                    std::cout << termcolor::on_green << 'I' << termcolor::reset;
-                    break;
-                case 'R':
-                    std::cout << termcolor::on_bright_blue << 'R' << termcolor::reset;
-                    break;
-                case 'P':
-                    std::cout << termcolor::yellow << 'P' << termcolor::reset;
-                    break;
-                case 'M':
-                    std::cout << termcolor::on_bright_red << 'M' << termcolor::reset;
-                    break;
-                default:
-                    std::cout << labyrinth[r][c];
-                    break;
+        const Cell* cells = labyrinth[r];
+        if (runLengthEncoded) {
+            bool wall = false;
+            uint32_t run = 0;
+            for (unsigned int c = 0; c < width; c++) {
+                if ((cells[c].getVal() == '#') != wall) {
+                    writeVarint(buffer, run);
+                    wall = !wall;
+                    run = 0;
+                }
+                run++;
+            }
+            writeVarint(buffer, run);
+        } else {
+            std::size_t offset = buffer.size();
+            buffer.resize(offset + rowBytes, 0);
+            for (unsigned int c = 0; c < width; c++) {
+                if (cells[c].getVal() == '#') {
+                    buffer[offset + (c >> 3)] |= static_cast<unsigned char>(1u << (c & 7));
                 }
-            } else {
-                std::cout << ' ';
             }
         }
-        std::cout << "\n";
     }
+
+    header.payloadSize = static_cast<uint32_t>(buffer.size() - sizeof(header));
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    header.checksum = fnv1a(buffer.data(), buffer.size());
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    std::ofstream file(filename, std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(file);
+}
+
+void Labyrinth::printWithFogOfWar(const Cell& playerPos) const
+{       
+    TRACE_SCOPE("Labyrinth::printWithFogOfWar");
+    printRows(nullptr, &playerPos);
+}
+
+void Labyrinth::printWithFogOfWar(const Cell& playerPos, const std::string& frame) const
+{
+    TRACE_SCOPE("Labyrinth::printWithFogOfWar");
+    printRows(frame.size() == static_cast<std::size_t>(width) * height ? frame.data() : nullptr, &playerPos);
 }
 
 void Labyrinth::setCell(unsigned int row, unsigned int col, const Cell& cell)
 {
     if (row < height && col < width) {
         labyrinth[row][col] = cell;
+        updateOpenMasks(row, col);
+        if (floorIndexed) {
+            indexFloorCells();
+        }
     }
 }
 
@@ -544,29 +1025,58 @@ void Labyrinth::setCell(unsigned int row, unsigned int col, const Cell& cell)
  * 
  * @param row The row index of the cell.
  * @param col The column index of the cell.
+ * @return const Cell& Reference to the specified cell.
+ */
+const Cell& Labyrinth::getCell(unsigned int row, unsigned int col) const
+{
+    return labyrinth[row][col];
+}
+
+/**
+ * @brief Retrieves a writable reference to the specified cell in the labyrinth.
+ * 
+ * @param row The row index of the cell.
+ * @param col The column index of the cell.
  * @return Cell& Reference to the specified cell.
  */
-Cell& Labyrinth::getCell(unsigned int row, unsigned int col) const
+Cell& Labyrinth::getCell(unsigned int row, unsigned int col)
 {
     return labyrinth[row][col];
 }
 
-Cell Labyrinth::getStartPoint()
+const char* Labyrinth::wallGlyph(uint8_t walls)
+{
+    // Indexed by the wall neighbours: bit 0 up, bit 1 down, bit 2 left, bit 3 right
+    static const char* const GLYPHS[16] = {
+        "\u25A0", "\u2502", "\u2502", "\u2502",     // none, up, down, up+down
+        "\u2500", "\u2518", "\u2510", "\u2524",     // left, +up, +down, +up+down
+        "\u2500", "\u2514", "\u250C", "\u251C",     // right, +up, +down, +up+down
+        "\u2500", "\u2534", "\u252C", "\u253C"      // left+right, +up, +down, +up+down
+    };
+    return GLYPHS[walls & 0x0F];
+}
+
+void Labyrinth::setBoxDrawing(bool enabled)
+{
+    this->boxDrawing = enabled;
+}
+
+Cell Labyrinth::getStartPoint() const
 {
     return this->startPoint;
 }
 
-bool Labyrinth::getMapGenerationSuccess()
+bool Labyrinth::getMapGenerationSuccess() const
 {
     return mapGeneratedSuccessfully;
 }
 
-unsigned int Labyrinth::getWidth()
+unsigned int Labyrinth::getWidth() const
 {
     return this->width;
 }
 
-unsigned int Labyrinth::getHeight()
+unsigned int Labyrinth::getHeight() const
 {
     return this->height;
 }
@@ -576,6 +1086,16 @@ uint64_t Labyrinth::getGenerationTime() const
     return this->generation_time;
 }
 
+unsigned int Labyrinth::getSeed() const
+{
+    return this->seed;
+}
+
+const GenerationStats& Labyrinth::getGenerationStats() const
+{
+    return this->generationStats;
+}
+
 //------------------------------------------------------------------------------
 // BFS: find a path from entrance 'U' to exit 'I'
 //------------------------------------------------------------------------------
@@ -585,6 +1105,8 @@ uint64_t Labyrinth::getGenerationTime() const
 //
 std::list<Cell*> Labyrinth::findPathFromEntranceToExit()
 {
+    TRACE_SCOPE("Labyrinth::findPathFromEntranceToExit");
+
     int startR = startPoint.getRow();
     int startC = startPoint.getCol();
     int endR = endPoint.getRow();
@@ -610,9 +1132,6 @@ std::list<Cell*> Labyrinth::findPathFromEntranceToExit()
     q.push(startCell);
     visited[startR][startC] = true;
 
-    const int DR[4] = {-1, 1, 0, 0};
-    const int DC[4] = { 0, 0,-1, 1};
-
     bool found = false;
 
     // Basic BFS for pathfinding and filling the parent array
@@ -629,14 +1148,12 @@ std::list<Cell*> Labyrinth::findPathFromEntranceToExit()
             break;
         }
 
+        const uint8_t open = openMasks[static_cast<std::size_t>(curR) * width + curC];
         for (int i = 0; i < 4; i++) {
-            int nr = curR + DR[i];
-            int nc = curC + DC[i];
+            int nr = curR + DIRECTION_ROW[i];
+            int nc = curC + DIRECTION_COL[i];
 
-            if (nr >= 0 && nr < (int)height &&
-                nc >= 0 && nc < (int)width &&
-                !visited[nr][nc] &&
-                labyrinth[nr][nc].getVal() != '#')
+            if ((open & (1u << i)) && !visited[nr][nc])
             {
                 visited[nr][nc] = true;
                 parent[nr][nc] = current;
@@ -661,12 +1178,12 @@ std::list<Cell*> Labyrinth::findPathFromEntranceToExit()
     return path; 
 }
 
-Cell Labyrinth::getEndPoint()
+Cell Labyrinth::getEndPoint() const
 {
     return this->endPoint;
 }
 
-std::list<Cell*> Labyrinth::getPathFromEntranceToExit()
+std::list<Cell*> Labyrinth::getPathFromEntranceToExit() const
 {
     return this->pathFromEntranceToExit;
 }
@@ -3,10 +3,13 @@
 #include <fstream>
 #include <string>
 #include <ctime>
+#include <cstring>
+#include <algorithm>
+#include <cctype>
 
 /**
  * @brief Retrieves the current system time formatted as a string.
- * 
+ *
  * @return std::string The current time in "YYYY-MM-DD HH:MM:SS" format.
  */
 std::string Logger::getCurrentTime(){
@@ -18,25 +21,77 @@ std::string Logger::getCurrentTime(){
 
 /**
  * @brief Constructs a Logger object and opens the specified log file.
- * 
+ *
  * @param filename The name of the log file to create or overwrite.
- * 
+ *
  * @details Opens the log file in write mode. If the file cannot be opened,
  *          an error message is displayed to the standard error stream.
  */
-Logger::Logger(const std::string& filename) {
+Logger::Logger(const std::string& filename) : Logger(filename, LoggerOptions()) {
+}
+
+/**
+ * @brief Constructs a Logger object with the given options.
+ *
+ * @param filename The name of the log file to create or overwrite.
+ * @param options Synchronous/asynchronous mode and flush policy.
+ *
+ * @details In asynchronous mode the ring is allocated once, the file stream gets a large
+ *          buffer so a batch turns into few system calls, and the writer thread is started.
+ *          An empty filename disables the logger: no file is opened and no thread is started.
+ */
+Logger::Logger(const std::string& filename, const LoggerOptions& options)
+    : options(options), threshold(options.level) {
+    if (filename.empty()) {
+        this->options.async = false;
+        disabled = true;
+        return;
+    }
+
+    if (this->options.async) {
+        const std::size_t bufferSize = 64 * 1024;
+        streamBuffer.reset(new char[bufferSize]);
+        logFile.rdbuf()->pubsetbuf(streamBuffer.get(), bufferSize); // Must be set before open()
+    }
+
     logFile.open(filename, std::ios::out);                  // Open log file in write mode
     if (!logFile) {
         std::cerr << "Error: Unable to open log file: " << filename << std::endl; // Error handling
     }
+    fileOpen = logFile.is_open();
+
+    if (this->options.async) {
+        // Round the capacity up to a power of two so positions can be wrapped with a mask
+        std::size_t capacity = 2;
+        while (capacity < this->options.ringCapacity) {
+            capacity <<= 1;
+        }
+        ring.reset(new Record[capacity]);
+        ringMask = capacity - 1;
+        for (std::size_t i = 0; i < capacity; i++) {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        running.store(true);
+        writer = std::thread(&Logger::writerLoop, this);
+    }
 }
 
 /**
  * @brief Destructor for the Logger class.
- * 
- * @details Closes the log file if it is open.
+ *
+ * @details Stops the writer thread, writes the records still in the ring and closes the log file.
  */
 Logger::~Logger() {
+    if (writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            running.store(false);
+        }
+        wakeCondition.notify_one();
+        writer.join();                                       // Writer drains and flushes before exiting
+    }
+
     if (logFile.is_open()) {                                 // Check if log file is open
         logFile.close();                                     // Close the log file
     }
@@ -44,13 +99,24 @@ Logger::~Logger() {
 
 /**
  * @brief Logs a message to the log file with a timestamp.
- * 
+ *
  * @param message The message to be logged.
- * 
+ * @param level Severity of the message.
+ *
  * @details If the log file is open, the message is written to the file
- *          prefixed with the current timestamp.
+ *          prefixed with the current timestamp. In asynchronous mode the message
+ *          is only copied into the ring; the writer thread adds the timestamp.
  */
-void Logger::log(const std::string& message) {
+void Logger::log(const std::string& message, LogLevel level) {
+    if (!isEnabled(level)) {
+        return;
+    }
+
+    if (options.async) {
+        enqueue(message, level, true);
+        return;
+    }
+
     if (logFile.is_open()) {                                 // Check if log file is open
         logFile << "[" << getCurrentTime() << "] " << message << std::endl; // Write timestamped message
         logFile.flush();                                     // Force write to file immediately
@@ -58,10 +124,190 @@ void Logger::log(const std::string& message) {
 }
 
 void Logger::save(const std::string& message) {
+    if (options.async) {
+        enqueue(message, LogLevel::INFO, false);
+        return;
+    }
+
     if (logFile.is_open()) {                                 // Check if log file is open
         logFile << message << std::endl;                     // Write the message to the log file
         logFile.flush();                                     // Force write to file immediately
-    } else {
+    } else if (!disabled) {
         std::cerr << "Error: Log file is not open." << std::endl; // Error handling if log file is not open
     }
-}
\ No newline at end of file
+}
+
+LogLevel Logger::parseLevel(const std::string& name, LogLevel fallback) {
+    std::string lower;
+    for (char c : name) {
+        lower += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+
+    if (lower == "trace") return LogLevel::TRACE;
+    if (lower == "debug") return LogLevel::DEBUG;
+    if (lower == "info")  return LogLevel::INFO;
+    if (lower == "warn")  return LogLevel::WARN;
+    if (lower == "off")   return LogLevel::OFF;
+    return fallback;
+}
+
+/**
+ * @brief Blocks until every record enqueued so far has been written and flushed.
+ */
+void Logger::flush() {
+    if (!options.async) {
+        if (logFile.is_open()) {
+            logFile.flush();
+        }
+        return;
+    }
+
+    const std::size_t target = enqueuePos.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    while (flushedPos < target && running.load()) {
+        flushRequested.store(true);
+        wakeCondition.notify_one();
+        flushedCondition.wait_for(lock, options.flushInterval);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Asynchronous mode
+//------------------------------------------------------------------------------
+//
+// The ring is a bounded queue in the style of D. Vyukov: every record carries a
+// sequence number telling whether it is free for position `pos` (sequence == pos)
+// or holds a published message (sequence == pos + 1). Producers claim positions
+// with a CAS on `enqueuePos`, so several threads may log at once without locks.
+// The only consumer is the writer thread.
+//
+void Logger::enqueue(const std::string& message, LogLevel level, bool timestamped) {
+    if (!fileOpen) {
+        return;
+    }
+
+    std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Record* record = nullptr;
+
+    for (;;) {
+        record = &ring[pos & ringMask];
+        std::size_t sequence = record->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Ring is full: never block the game loop, just account for the loss
+            droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t length = std::min(message.size(), MAX_MESSAGE_LENGTH);
+    std::memcpy(record->text, message.data(), length);
+    record->length = static_cast<uint16_t>(length);
+    record->level = level;
+    record->timestamped = timestamped;
+    record->timestamp = timestamped ? std::time(nullptr) : 0;
+    record->sequence.store(pos + 1, std::memory_order_release); // Publish the record
+
+    if (options.flushPolicy == FlushPolicy::ON_LEVEL && level >= options.flushLevel) {
+        urgentFlush.store(true, std::memory_order_relaxed);
+        wakeCondition.notify_one();
+    }
+}
+
+const char* Logger::formatTime(std::time_t timestamp) {
+    if (timestamp != cachedSecond) {
+        std::tm local;
+        localtime_r(&timestamp, &local);
+        std::strftime(cachedTime, sizeof(cachedTime), "%Y-%m-%d %H:%M:%S", &local);
+        cachedSecond = timestamp;
+    }
+    return cachedTime;
+}
+
+bool Logger::drain(std::string& batch) {
+    bool sawFlushLevel = false;
+    batch.clear();
+
+    for (;;) {
+        Record& record = ring[dequeuePos & ringMask];
+        std::size_t sequence = record.sequence.load(std::memory_order_acquire);
+        if (sequence != dequeuePos + 1) {
+            break;                                           // Nothing more published yet
+        }
+
+        if (record.timestamped) {
+            batch += '[';
+            batch += formatTime(record.timestamp);
+            batch += "] ";
+        }
+        batch.append(record.text, record.length);
+        batch += '\n';
+        sawFlushLevel = sawFlushLevel || record.level >= options.flushLevel;
+
+        // Hand the record back to producers for the next lap of the ring
+        record.sequence.store(dequeuePos + ringMask + 1, std::memory_order_release);
+        dequeuePos++;
+    }
+
+    uint64_t dropped = droppedRecords.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        batch += "[";
+        batch += formatTime(std::time(nullptr));
+        batch += "] Logger ring full, dropped " + std::to_string(dropped) + " record(s)\n";
+    }
+
+    if (!batch.empty()) {
+        logFile.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+    }
+    return sawFlushLevel;
+}
+
+void Logger::writerLoop() {
+    std::string batch;
+    batch.reserve(64 * 1024);
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait_for(lock, options.flushInterval, [this] {
+                return !running.load() || urgentFlush.load() || flushRequested.load();
+            });
+        }
+
+        const bool stopping = !running.load();
+        const bool forced = flushRequested.exchange(false);
+        urgentFlush.store(false);
+
+        bool sawFlushLevel = drain(batch);
+
+        bool flushNow = stopping || forced;
+        switch (options.flushPolicy) {
+            case FlushPolicy::ON_INTERVAL:
+                flushNow = flushNow || !batch.empty();
+                break;
+            case FlushPolicy::ON_LEVEL:
+                flushNow = flushNow || sawFlushLevel;
+                break;
+            case FlushPolicy::ON_EXIT:
+                break;
+        }
+
+        if (flushNow) {
+            logFile.flush();
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            flushedPos = dequeuePos;
+        }
+        flushedCondition.notify_all();
+
+        if (stopping) {
+            return;
+        }
+    }
+}
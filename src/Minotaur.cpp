@@ -17,7 +17,10 @@ Minotaur::~Minotaur()
  */
 Cell Minotaur::getPosition() const
 {
-    return this->position;
+    if (index >= herd->size()) {
+        return Cell();
+    }
+    return Cell(herd->getRow(index), herd->getCol(index), 'M');
 }
 
 /**
@@ -27,5 +30,7 @@ Cell Minotaur::getPosition() const
  */
 void Minotaur::setPosition(const Cell& position)
 {
-    this->position = position;
+    if (index < herd->size()) {
+        herd->moveTo(index, static_cast<uint32_t>(position.getRow()) * herd->getWidth() + static_cast<uint32_t>(position.getCol()));
+    }
 }
\ No newline at end of file
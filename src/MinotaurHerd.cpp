@@ -0,0 +1,122 @@
+#include "MinotaurHerd.h"
+
+void MinotaurHerd::reset(uint32_t width)
+{
+    this->width = width;
+    cells.clear();
+    alive.clear();
+    occupancy.clear();
+    living = 0;
+}
+
+uint32_t MinotaurHerd::add(uint32_t cell)
+{
+    cells.push_back(cell);
+    alive.push_back(1);
+    living++;
+    if (!occupancy.empty() && 2 * living <= occupancy.size()) {
+        occupy(cell);
+    } else if (cells.size() > SCAN_LIMIT) {
+        // Past the scan limit, or the table is half full: (re)build it twice as large
+        std::size_t entries = 2 * SCAN_LIMIT;
+        while (entries < 2 * living) {
+            entries *= 2;
+        }
+        rebuild(entries);
+    }
+    return static_cast<uint32_t>(cells.size() - 1);
+}
+
+void MinotaurHerd::moveTo(uint32_t index, uint32_t cell)
+{
+    if (alive[index] && !occupancy.empty()) {
+        leave(cells[index]);
+        occupy(cell);
+    }
+    cells[index] = cell;
+}
+
+void MinotaurHerd::kill(uint32_t index)
+{
+    if (!alive[index]) {
+        return;
+    }
+    alive[index] = 0;
+    if (!occupancy.empty()) {
+        leave(cells[index]);
+    }
+    living--;
+}
+
+bool MinotaurHerd::isOccupied(uint32_t cell) const
+{
+    if (!occupancy.empty()) {
+        return occupancy[slotOf(cell)].cell == cell;
+    }
+    for (std::size_t index = 0; index < cells.size(); index++) {
+        if (cells[index] == cell && alive[index]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int MinotaurHerd::findAt(uint32_t cell) const
+{
+    if (!occupancy.empty() && occupancy[slotOf(cell)].cell != cell) {
+        return -1;
+    }
+    for (std::size_t index = 0; index < cells.size(); index++) {
+        if (cells[index] == cell && alive[index]) {
+            return static_cast<int>(index);
+        }
+    }
+    return -1;
+}
+
+std::size_t MinotaurHerd::slotOf(uint32_t cell) const
+{
+    const std::size_t mask = occupancy.size() - 1;
+    std::size_t slot = home(cell);
+    while (occupancy[slot].cell != cell && occupancy[slot].cell != EMPTY) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void MinotaurHerd::occupy(uint32_t cell)
+{
+    Occupancy& entry = occupancy[slotOf(cell)];
+    entry.cell = cell;
+    entry.count++;
+}
+
+// Backward-shift deletion: entries after the freed one move up unless their probe starts
+// after it, so lookups never need tombstones however often minotaurs move
+void MinotaurHerd::leave(uint32_t cell)
+{
+    const std::size_t mask = occupancy.size() - 1;
+    std::size_t hole = slotOf(cell);
+    if (--occupancy[hole].count > 0) {
+        return;
+    }
+    for (std::size_t next = (hole + 1) & mask; occupancy[next].cell != EMPTY; next = (next + 1) & mask) {
+        const std::size_t start = home(occupancy[next].cell);
+        const bool reachable = hole <= next ? (start <= hole || start > next) : (start <= hole && start > next);
+        if (reachable) {
+            occupancy[hole] = occupancy[next];
+            hole = next;
+        }
+    }
+    occupancy[hole] = Occupancy{ EMPTY, 0 };
+}
+
+void MinotaurHerd::rebuild(std::size_t entries)
+{
+    occupancy.assign(entries, Occupancy{ EMPTY, 0 });
+    for (std::size_t index = 0; index < cells.size(); index++) {
+        if (alive[index]) {
+            occupy(cells[index]);
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#include "Observation.h"
+#include <cstring>
+
+void fillObservation(const GameView& view, int radius, uint8_t* out)
+{
+    const int side = 2 * radius + 1;
+    const std::size_t plane = static_cast<std::size_t>(side) * side;
+    std::memset(out, 0, OBSERVATION_CHANNELS * plane); // OUTSIDE, no entities
+
+    const Cell player = view.getPlayer().getPosition();
+    const int top = player.getRow() - radius;
+    const int left = player.getCol() - radius;
+
+    uint8_t* terrain = out + CHANNEL_TERRAIN * plane;
+    for (int wr = 0; wr < side; wr++) {
+        const int row = top + wr;
+        if (row < 0 || row >= view.getHeight()) {
+            continue;
+        }
+        for (int wc = 0; wc < side; wc++) {
+            const int col = left + wc;
+            if (col >= 0 && col < view.getWidth()) {
+                terrain[wr * side + wc] = static_cast<uint8_t>(terrainCodeOf(view.cellAt(row, col)));
+            }
+        }
+    }
+
+    // Entities come from their positions, not from the characters in the grid
+    auto windowIndex = [&](const Cell& cell) -> int {
+        const int wr = cell.getRow() - top;
+        const int wc = cell.getCol() - left;
+        return (wr >= 0 && wr < side && wc >= 0 && wc < side) ? wr * side + wc : -1;
+    };
+
+    const MinotaurHerd& minotaurs = view.getMinotaurs();
+    for (uint32_t id = 0; id < minotaurs.size(); id++) {
+        if (minotaurs.isAlive(id)) {
+            const int index = windowIndex(Cell(minotaurs.getRow(id), minotaurs.getCol(id), 'M'));
+            if (index >= 0) {
+                out[CHANNEL_MINOTAUR * plane + index] = 1;
+            }
+        }
+    }
+    const ItemPool& items = view.getItems();
+    for (uint32_t id : items.lying()) {
+        const Item& item = items[id];
+        const int index = windowIndex(item.getPosition());
+        if (index >= 0) {
+            out[CHANNEL_ITEMS * plane + index] = static_cast<uint8_t>(static_cast<uint8_t>(item.getKind()) + 1);
+        }
+    }
+}
@@ -0,0 +1,216 @@
+#include "Replay.h"
+#include <cstring>
+#include <iostream>
+
+static const char REPLAY_MAGIC[4] = { 'L', 'B', 'R', 'P' };
+
+// LEB128: seven bits per byte, lowest first, the high bit set on all but the last byte
+static void writeVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+static bool readVarint(std::istream& in, uint64_t& value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+        const int byte = in.get();
+        if (byte == std::char_traits<char>::eof()) {
+            return false;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Bytes between the read position and the end of the stream
+static std::streamoff remainingBytes(std::istream& in)
+{
+    const std::streampos position = in.tellg();
+    if (position < 0 || !in.seekg(0, std::ios::end)) {
+        return 0;
+    }
+    const std::streampos end = in.tellg();
+    in.seekg(position);
+    return end - position;
+}
+
+static bool readVarint32(std::istream& in, uint32_t& value)
+{
+    uint64_t wide;
+    if (!readVarint(in, wide) || wide > UINT32_MAX) {
+        return false;
+    }
+    value = static_cast<uint32_t>(wide);
+    return true;
+}
+
+/**
+ * @brief Creates the replay file and writes its header.
+ *
+ * @param filename Path of the file to create. An empty name disables the replay.
+ * @param header Parameters of the game; its labyrinth file name may hold at most MAX_FILE_NAME bytes.
+ * @return true If the file was created.
+ */
+bool ReplayWriter::open(const std::string& filename, const ReplayHeader& header)
+{
+    if (filename.empty()) {
+        return false;
+    }
+    if (header.labyrinthFile.size() > MAX_FILE_NAME) {
+        std::cerr << "Error: Labyrinth file name too long for replay: " << header.labyrinthFile << std::endl;
+        return false;
+    }
+
+    file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Error: Unable to open replay file: " << filename << std::endl;
+        return false;
+    }
+
+    buffer.clear();
+    buffer.reserve(BUFFER_BYTES + 16);
+    buffer.insert(buffer.end(), REPLAY_MAGIC, REPLAY_MAGIC + 4);
+    writeVarint(buffer, VERSION);
+    writeVarint(buffer, header.width);
+    writeVarint(buffer, header.height);
+    writeVarint(buffer, header.labyrinthSeed);
+    writeVarint(buffer, header.seed);
+    writeVarint(buffer, header.numItems);
+    writeVarint(buffer, header.minotaurTicks);
+    writeVarint(buffer, header.minotaurCount);
+    writeVarint(buffer, (header.chasingMinotaurs ? 1u : 0u) | (header.reachableItemsOnly ? 2u : 0u));
+    writeVarint(buffer, header.labyrinthFile.size());
+    buffer.insert(buffer.end(), header.labyrinthFile.begin(), header.labyrinthFile.end());
+    lastTick = 0;
+    flush();
+    return true;
+}
+
+/**
+ * @brief Writes the buffered records and closes the file.
+ */
+ReplayWriter::~ReplayWriter()
+{
+    if (file.is_open()) {
+        flush();
+        file.close();
+    }
+}
+
+/**
+ * @brief Appends one record to the buffer.
+ *
+ * @param tick Tick of the record.
+ * @param action Action of the record, or END.
+ */
+void ReplayWriter::append(uint32_t tick, uint8_t action)
+{
+    const uint64_t delta = tick >= lastTick ? tick - lastTick : 0;
+    writeVarint(buffer, (delta << ACTION_BITS) | (action & END));
+    lastTick = tick;
+    if (buffer.size() >= BUFFER_BYTES) {
+        flush();
+    }
+}
+
+/**
+ * @brief Writes the END record and closes the file.
+ *
+ * @param tick Tick at which the game ended.
+ */
+void ReplayWriter::finish(uint32_t tick)
+{
+    if (!file.is_open()) {
+        return;
+    }
+    append(tick, END);
+    flush();
+    file.close();
+}
+
+/**
+ * @brief Writes all buffered bytes to the file with a single write.
+ */
+void ReplayWriter::flush()
+{
+    if (!file.is_open() || buffer.empty()) {
+        return;
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    file.flush();
+    buffer.clear();
+}
+
+/**
+ * @brief Opens a replay file and reads its header.
+ *
+ * @param filename Path of the replay.
+ *
+ * @details A missing file, a wrong magic, an unknown version or a labyrinth file name longer
+ * than ReplayWriter::MAX_FILE_NAME or than the rest of the file leave the reader invalid.
+ */
+ReplayReader::ReplayReader(const std::string& filename)
+    : file(filename, std::ios::in | std::ios::binary)
+{
+    char magic[4];
+    if (!file || !file.read(magic, 4) || std::memcmp(magic, REPLAY_MAGIC, 4) != 0) {
+        return;
+    }
+
+    uint32_t version, flags, fileLength;
+    if (!readVarint32(file, version) || version != ReplayWriter::VERSION ||
+        !readVarint32(file, header.width) || !readVarint32(file, header.height) ||
+        !readVarint32(file, header.labyrinthSeed) || !readVarint32(file, header.seed) ||
+        !readVarint32(file, header.numItems) || !readVarint32(file, header.minotaurTicks) ||
+        !readVarint32(file, header.minotaurCount) || !readVarint32(file, flags) ||
+        !readVarint32(file, fileLength)) {
+        return;
+    }
+    header.chasingMinotaurs = (flags & 1u) != 0;
+    header.reachableItemsOnly = (flags & 2u) != 0;
+
+    if (fileLength > ReplayWriter::MAX_FILE_NAME || fileLength > remainingBytes(file)) {
+        return;
+    }
+    header.labyrinthFile.resize(fileLength);
+    if (fileLength > 0 && !file.read(&header.labyrinthFile[0], fileLength)) {
+        return;
+    }
+    valid = true;
+}
+
+/**
+ * @brief Reads the next action.
+ *
+ * @param tick Receives the tick the action was played in.
+ * @param action Receives the raw PlayerAction.
+ * @return true If an action was read.
+ */
+bool ReplayReader::next(uint32_t& tick, uint8_t& action)
+{
+    uint64_t record;
+    if (!valid || ended || !readVarint(file, record)) {
+        return false;
+    }
+
+    const uint64_t nextTick = lastTick + (record >> ReplayWriter::ACTION_BITS);
+    if (nextTick > UINT32_MAX) {
+        return false;
+    }
+    lastTick = static_cast<uint32_t>(nextTick);
+    action = static_cast<uint8_t>(record & ReplayWriter::END);
+    if (action == ReplayWriter::END) {
+        ended = true;
+        return false;
+    }
+    tick = lastTick;
+    return true;
+}
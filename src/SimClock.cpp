@@ -0,0 +1,51 @@
+#include "SimClock.h"
+#include <thread>
+
+/**
+ * @brief Creates a clock.
+ *
+ * @param speed Speed-up over real time; 0 (or less) advances ticks as fast as possible.
+ */
+SimClock::SimClock(double speed)
+    : speed(speed > 0.0 ? speed : 0.0), startTime(Clock::now())
+{
+}
+
+/**
+ * @brief Makes the current wall-clock time the start of tick 0.
+ */
+void SimClock::start()
+{
+    startTime = Clock::now();
+}
+
+/**
+ * @brief Wall-clock time at which a tick starts, relative to start().
+ *
+ * @param tick The tick.
+ * @return Clock::duration Zero for an unpaced clock.
+ */
+SimClock::Clock::duration SimClock::offsetOf(uint64_t tick) const
+{
+    if (!isPaced()) {
+        return Clock::duration::zero();
+    }
+    const std::chrono::duration<double, std::milli> offset(static_cast<double>(tick) * TICK_MILLIS / speed);
+    return std::chrono::duration_cast<Clock::duration>(offset);
+}
+
+/**
+ * @brief Waits until a tick is due.
+ *
+ * @param tick The tick about to run.
+ */
+void SimClock::waitForTick(uint64_t tick) const
+{
+    if (!isPaced()) {
+        return;
+    }
+    const Clock::time_point due = startTime + offsetOf(tick);
+    if (Clock::now() < due) {
+        std::this_thread::sleep_until(due);
+    }
+}
@@ -0,0 +1,149 @@
+#include "Telemetry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+//------------------------------------------------------------------------------
+// Bucket layout: values below SUB_BUCKETS get one bucket each. Above that, the
+// range [2^k, 2^(k+1)) is split into SUB_BUCKETS equal buckets, using the bits
+// right below the highest set bit as the sub-bucket index.
+//------------------------------------------------------------------------------
+unsigned int LatencyHistogram::bucketOf(uint64_t value)
+{
+    if (value < SUB_BUCKETS) {
+        return static_cast<unsigned int>(value);
+    }
+    unsigned int highestBit = 63 - static_cast<unsigned int>(__builtin_clzll(value));
+    unsigned int range = highestBit - SUB_BUCKET_BITS + 1;
+    unsigned int sub = static_cast<unsigned int>((value >> (highestBit - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    return range * SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::upperBoundOf(unsigned int bucket)
+{
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    unsigned int range = bucket / SUB_BUCKETS;
+    uint64_t sub = bucket % SUB_BUCKETS;
+    unsigned int shift = range - 1;
+    uint64_t lower = (uint64_t(SUB_BUCKETS) + sub) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+void LatencyHistogram::record(uint64_t ns)
+{
+    counts[bucketOf(ns)]++;
+    total++;
+    sum += ns;
+    maximum = std::max(maximum, ns);
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const
+{
+    if (total == 0) {
+        return 0;
+    }
+    // Nearest-rank: the smallest bucket covering ceil(percent% of the samples)
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(total)));
+    rank = std::min(std::max<uint64_t>(rank, 1), total);
+
+    uint64_t seen = 0;
+    for (unsigned int bucket = 0; bucket < BUCKETS; bucket++) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            return std::min(upperBoundOf(bucket), maximum);
+        }
+    }
+    return maximum;
+}
+
+void LatencyHistogram::reset()
+{
+    counts.fill(0);
+    total = 0;
+    sum = 0;
+    maximum = 0;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for (unsigned int bucket = 0; bucket < BUCKETS; bucket++) {
+        counts[bucket] += other.counts[bucket];
+    }
+    total += other.total;
+    sum += other.sum;
+    maximum = std::max(maximum, other.maximum);
+}
+
+void RollingLatencyHistogram::record(uint64_t ns, uint64_t atNs)
+{
+    const uint64_t second = atNs / SLOT_NANOS;
+    const unsigned int slot = static_cast<unsigned int>(second % WINDOW_SLOTS);
+    if (slotSecond[slot] != second + 1) {
+        slots[slot].reset();
+        slotSecond[slot] = second + 1;
+    }
+    slots[slot].record(ns);
+}
+
+LatencyHistogram RollingLatencyHistogram::window(uint64_t atNs) const
+{
+    const uint64_t second = atNs / SLOT_NANOS;
+    LatencyHistogram merged;
+    for (unsigned int slot = 0; slot < WINDOW_SLOTS; slot++) {
+        // Tags are second + 1: a slot is in the window if its second is within the last WINDOW_SLOTS
+        if (slotSecond[slot] != 0 && slotSecond[slot] + WINDOW_SLOTS > second + 1 && slotSecond[slot] <= second + 1) {
+            merged.merge(slots[slot]);
+        }
+    }
+    return merged;
+}
+
+const char* FrameTelemetry::phaseName(FramePhase phase)
+{
+    switch (phase) {
+        case FramePhase::INPUT:         return "input";
+        case FramePhase::MINOTAUR:      return "minotaur";
+        case FramePhase::COLLISION:     return "collision";
+        case FramePhase::RENDER:        return "render";
+        case FramePhase::SLEEP:         return "sleep";
+        case FramePhase::FRAME:         return "frame";
+        case FramePhase::INPUT_LATENCY: return "input_latency";
+        default:                        return "unknown";
+    }
+}
+
+/**
+ * @brief Writes the summary of every phase to a file.
+ *
+ * @details Values are converted from nanoseconds to microseconds with one decimal.
+ */
+bool FrameTelemetry::save(const std::string& filename) const
+{
+    std::ofstream file(filename, std::ios::out);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    char line[240];
+    std::snprintf(line, sizeof(line), "%-14s %8s %10s %10s %10s %10s %10s %8s %10s %10s %10s\n",
+                  "phase", "samples", "p50_us", "p95_us", "p99_us", "mean_us", "max_us",
+                  "recent", "r_p50_us", "r_p95_us", "r_p99_us");
+    file << line;
+
+    for (std::size_t i = 0; i < histograms.size(); i++) {
+        const LatencyHistogram& h = histograms[i];
+        const LatencyHistogram r = rolling[i].window(now);
+        std::snprintf(line, sizeof(line), "%-14s %8llu %10.1f %10.1f %10.1f %10.1f %10.1f %8llu %10.1f %10.1f %10.1f\n",
+                      phaseName(static_cast<FramePhase>(i)),
+                      static_cast<unsigned long long>(h.count()),
+                      h.percentile(50) / 1000.0, h.percentile(95) / 1000.0, h.percentile(99) / 1000.0,
+                      h.mean() / 1000.0, h.max() / 1000.0,
+                      static_cast<unsigned long long>(r.count()),
+                      r.percentile(50) / 1000.0, r.percentile(95) / 1000.0, r.percentile(99) / 1000.0);
+        file << line;
+    }
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,137 @@
+#include "TimerWheel.h"
+
+/**
+ * @brief Drops all timers and sets the clock.
+ *
+ * @param time The new current time.
+ */
+void TimerWheel::reset(uint64_t time)
+{
+    nodes.clear();
+    freeNodes = NONE;
+    for (unsigned int level = 0; level < LEVELS; level++) {
+        for (unsigned int slot = 0; slot < SLOTS; slot++) {
+            slots[level][slot] = List();
+        }
+        occupied[level] = 0;
+    }
+    overflow = List();
+    now = time;
+    pendingCount = 0;
+}
+
+/**
+ * @brief Schedules a timer.
+ *
+ * @param deadline Time at which the timer fires.
+ * @param type Owner-defined type of the timer.
+ * @param id Owner-defined id of the timer.
+ */
+void TimerWheel::schedule(uint64_t deadline, uint8_t type, uint32_t id)
+{
+    if (deadline <= now) {
+        deadline = now + 1;
+    }
+
+    uint32_t node;
+    if (freeNodes != NONE) {
+        node = freeNodes;
+        freeNodes = nodes[node].next;
+    } else {
+        node = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(Node());
+    }
+    nodes[node].timer = Timer{ deadline, id, type };
+    place(node);
+    pendingCount++;
+}
+
+/**
+ * @brief Links a node into the slot its deadline belongs to relative to `now`.
+ *
+ * @details The level is given by the highest base-SLOTS digit in which the deadline differs
+ *          from the current time.
+ */
+void TimerWheel::place(uint32_t node)
+{
+    const uint64_t deadline = nodes[node].timer.deadline;
+    const uint64_t differs = deadline ^ now;
+
+    List* list = &overflow;
+    unsigned int level = 0;
+    while (level < LEVELS && (differs >> ((level + 1) * SLOT_BITS)) != 0) {
+        level++;
+    }
+    if (level < LEVELS) {
+        const unsigned int slot = static_cast<unsigned int>((deadline >> (level * SLOT_BITS)) & (SLOTS - 1));
+        list = &slots[level][slot];
+        occupied[level] |= 1ull << slot;
+    }
+
+    nodes[node].next = NONE;
+    if (list->tail == NONE) {
+        list->head = node;
+    } else {
+        nodes[list->tail].next = node;
+    }
+    list->tail = node;
+}
+
+/**
+ * @brief Detaches the list of a slot and clears its occupancy bit.
+ */
+TimerWheel::List TimerWheel::take(unsigned int level, unsigned int slot)
+{
+    const List list = slots[level][slot];
+    slots[level][slot] = List();
+    occupied[level] &= ~(1ull << slot);
+    return list;
+}
+
+/**
+ * @brief Moves the timers of one slot of a higher level down to the lower levels.
+ *
+ * @details The list is walked in order, so timers keep their scheduling order.
+ */
+void TimerWheel::cascade(unsigned int level, unsigned int slot)
+{
+    const List list = take(level, slot);
+    for (uint32_t node = list.head; node != NONE; ) {
+        const uint32_t next = nodes[node].next;
+        place(node);
+        node = next;
+    }
+}
+
+/**
+ * @brief Sorts the overflow list into the levels again.
+ */
+void TimerWheel::cascadeOverflow()
+{
+    const List list = overflow;
+    overflow = List();
+    for (uint32_t node = list.head; node != NONE; ) {
+        const uint32_t next = nodes[node].next;
+        place(node);
+        node = next;
+    }
+}
+
+/**
+ * @brief Cascades the higher levels whose slot starts at `time`.
+ *
+ * @details Higher levels go first, so their timers can land in a lower slot that is
+ *          cascaded right after.
+ */
+void TimerWheel::cascadeAt(uint64_t time)
+{
+    if ((time & ((1ull << (LEVELS * SLOT_BITS)) - 1)) == 0) {
+        cascadeOverflow();
+    }
+    for (unsigned int level = LEVELS - 1; level > 0; level--) {
+        const unsigned int shift = level * SLOT_BITS;
+        if ((time & ((1ull << shift) - 1)) == 0) {
+            cascade(level, static_cast<unsigned int>((time >> shift) & (SLOTS - 1)));
+        }
+    }
+}
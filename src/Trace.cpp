@@ -0,0 +1,150 @@
+#include "Trace.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <unistd.h>
+
+static std::atomic<uint64_t> nextTracerId{1};
+
+// All timestamps are relative to program start, so spans that began before the
+// tracer was first used still get positive timestamps
+static const uint64_t originNs = Tracer::nowNs();
+
+/**
+ * @brief Creates an empty tracer.
+ *
+ * @param outputFile File written when the tracer is destroyed; empty to write nothing.
+ */
+Tracer::Tracer(const std::string& outputFile)
+    : id(nextTracerId.fetch_add(1)), outputFile(outputFile)
+{
+}
+
+Tracer::~Tracer()
+{
+    if (!outputFile.empty()) {
+        save(outputFile);
+    }
+}
+
+/**
+ * @brief Retrieves the tracer used by TRACE_SCOPE.
+ *
+ * @details In tracing builds the trace is written to `trace.json` (or $LABYRINTH_TRACE_FILE)
+ *          when static objects are destroyed at program exit.
+ */
+Tracer& Tracer::instance()
+{
+#if defined(LABYRINTH_TRACE) && LABYRINTH_TRACE
+    static Tracer tracer([] {
+        const char* file = std::getenv("LABYRINTH_TRACE_FILE");
+        return std::string(file && *file ? file : "trace.json");
+    }());
+#else
+    static Tracer tracer;
+#endif
+    return tracer;
+}
+
+uint64_t Tracer::nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Tracer::ThreadBuffer& Tracer::threadBuffer()
+{
+    // Most recently used first; ids are never reused, so entries of destroyed tracers never match
+    struct CachedBuffer {
+        uint64_t tracer;
+        ThreadBuffer* buffer;
+    };
+    static constexpr std::size_t CACHED_TRACERS = 4;
+    thread_local CachedBuffer cache[CACHED_TRACERS] = {};
+
+    if (cache[0].tracer == id) {
+        return *cache[0].buffer;
+    }
+
+    std::size_t slot = 1;
+    while (slot < CACHED_TRACERS && cache[slot].tracer != id) {
+        slot++;
+    }
+    CachedBuffer entry{ id, nullptr };
+    if (slot < CACHED_TRACERS) {
+        entry.buffer = cache[slot].buffer;
+    } else {
+        // Not cached: reuse the buffer this thread registered before, or register a new one
+        slot = CACHED_TRACERS - 1;
+        const std::thread::id self = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (const auto& buffer : buffers) {
+            if (buffer->owner == self) {
+                entry.buffer = buffer.get();
+                break;
+            }
+        }
+        if (!entry.buffer) {
+            buffers.emplace_back(new ThreadBuffer());
+            entry.buffer = buffers.back().get();
+            entry.buffer->owner = self;
+            entry.buffer->threadId = static_cast<uint32_t>(buffers.size());
+            entry.buffer->spans.reserve(4096);
+        }
+    }
+    for (; slot > 0; slot--) {
+        cache[slot] = cache[slot - 1];
+    }
+    cache[0] = entry;
+    return *entry.buffer;
+}
+
+void Tracer::record(const char* name, uint64_t startNs, uint64_t endNs)
+{
+    threadBuffer().spans.push_back(Span{ name, startNs - originNs, endNs - startNs });
+}
+
+std::size_t Tracer::spanCount()
+{
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    std::size_t count = 0;
+    for (const auto& buffer : buffers) {
+        count += buffer->spans.size();
+    }
+    return count;
+}
+
+/**
+ * @brief Writes all recorded spans as a Trace Event Format JSON object.
+ *
+ * @details Spans are written as complete ("X") events with microsecond timestamps,
+ *          one `tid` per recording thread and the process id as `pid`.
+ */
+bool Tracer::save(const std::string& filename)
+{
+    std::ofstream file(filename, std::ios::out);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    const long pid = static_cast<long>(getpid());
+    char line[256];
+    bool first = true;
+
+    file << "{\"traceEvents\":[";
+    for (const auto& buffer : buffers) {
+        for (const Span& span : buffer->spans) {
+            std::snprintf(line, sizeof(line),
+                          "%s\n{\"name\":\"%s\",\"cat\":\"labyrinth\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%ld,\"tid\":%u}",
+                          first ? "" : ",", span.name, span.startNs / 1000.0, span.durationNs / 1000.0,
+                          pid, buffer->threadId);
+            file << line;
+            first = false;
+        }
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return static_cast<bool>(file);
+}
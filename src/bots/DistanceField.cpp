@@ -0,0 +1,77 @@
+#include "bots/DistanceField.h"
+
+const int DistanceField::ROW_OFFSETS[4] = { -1, 1, 0, 0 };
+const int DistanceField::COL_OFFSETS[4] = { 0, 0, -1, 1 };
+const PlayerAction DistanceField::MOVES[4] = { PlayerAction::UP, PlayerAction::DOWN, PlayerAction::LEFT, PlayerAction::RIGHT };
+
+void DistanceField::begin(const GameView& view)
+{
+    width = view.getWidth();
+    height = view.getHeight();
+    const std::size_t cells = static_cast<std::size_t>(width) * height;
+
+    // assign() and resize() keep the capacity, so only a larger grid allocates
+    distances.assign(cells, UNREACHABLE);
+    if (queue.size() < cells) {
+        queue.resize(cells);
+    }
+    queueTail = 0;
+}
+
+void DistanceField::addSource(const GameView& view, int row, int col)
+{
+    if (!view.isWalkable(row, col)) {
+        return;
+    }
+    uint32_t& distance = distances[static_cast<std::size_t>(row) * width + col];
+    if (distance == 0) {
+        return;
+    }
+    distance = 0;
+    queue[queueTail++] = static_cast<uint32_t>(row * width + col);
+}
+
+/**
+ * @brief Propagates the distances from all added sources.
+ * 
+ * @details Every cell is queued at most once, so the queue never outgrows one slot per cell.
+ *          Neighbours are expanded from the open-direction mask of the cell.
+ */
+void DistanceField::run(const GameView& view)
+{
+    std::size_t head = 0;
+    while (head < queueTail) {
+        const uint32_t index = queue[head++];
+        const int row = static_cast<int>(index) / width;
+        const int col = static_cast<int>(index) % width;
+        const uint32_t next = distances[index] + 1;
+
+        const uint8_t open = view.openDirections(row, col);
+        for (int d = 0; d < 4; d++) {
+            if (!(open & (1u << d))) {
+                continue;
+            }
+            const int r = row + ROW_OFFSETS[d];
+            const int c = col + COL_OFFSETS[d];
+            uint32_t& distance = distances[static_cast<std::size_t>(r) * width + c];
+            if (distance == UNREACHABLE) {
+                distance = next;
+                queue[queueTail++] = static_cast<uint32_t>(r * width + c);
+            }
+        }
+    }
+}
+
+PlayerAction DistanceField::stepFrom(int row, int col) const
+{
+    PlayerAction best = PlayerAction::NONE;
+    uint32_t bestDistance = at(row, col);
+    for (int d = 0; d < 4; d++) {
+        const uint32_t distance = at(row + ROW_OFFSETS[d], col + COL_OFFSETS[d]);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = MOVES[d];
+        }
+    }
+    return best;
+}
@@ -0,0 +1,47 @@
+#include "bots/ItemGreedyPolicy.h"
+
+/**
+ * @brief Marks the distance fields for recomputation; the policy uses no randomness.
+ */
+void ItemGreedyPolicy::reset(unsigned int)
+{
+    stale = true;
+}
+
+/**
+ * @brief Attacks, walks to the nearest item or walks to the exit.
+ * 
+ * @param view The game being played.
+ * @return PlayerAction The chosen action.
+ */
+PlayerAction ItemGreedyPolicy::nextAction(const GameView& view)
+{
+    if (canKillMinotaur(view)) {
+        return PlayerAction::ATTACK;
+    }
+
+    const ItemPool& items = view.getItems();
+    const std::size_t left = items.liveCount();
+
+    if (stale) {
+        toExit.begin(view);
+        toExit.addSource(view, view.getExit().getRow(), view.getExit().getCol());
+        toExit.run(view);
+    }
+    if (stale || left != itemsLeft) {
+        toItems.begin(view);
+        for (uint32_t id : items.lying()) {
+            const Cell position = items[id].getPosition();
+            toItems.addSource(view, position.getRow(), position.getCol());
+        }
+        toItems.run(view);
+        itemsLeft = left;
+        stale = false;
+    }
+
+    const Cell position = view.getPlayer().getPosition();
+    if (itemsLeft > 0 && toItems.at(position.getRow(), position.getCol()) != DistanceField::UNREACHABLE) {
+        return toItems.stepFrom(position.getRow(), position.getCol());
+    }
+    return toExit.stepFrom(position.getRow(), position.getCol());
+}
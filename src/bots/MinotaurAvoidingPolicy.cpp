@@ -0,0 +1,86 @@
+#include "bots/MinotaurAvoidingPolicy.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+/**
+ * @brief Marks the distance field for recomputation; the policy uses no randomness.
+ */
+void MinotaurAvoidingPolicy::reset(unsigned int)
+{
+    stale = true;
+}
+
+/**
+ * @brief Attacks, follows the path to the exit or evades the minotaur.
+ * 
+ * @param view The game being played.
+ * @return PlayerAction The chosen action.
+ * 
+ * @details 
+ * A minotaur moves at most one cell per tick, so a cell is dangerous when it is a living
+ * minotaur's cell or one of its four neighbours.
+ */
+PlayerAction MinotaurAvoidingPolicy::nextAction(const GameView& view)
+{
+    if (stale) {
+        toExit.begin(view);
+        toExit.addSource(view, view.getExit().getRow(), view.getExit().getCol());
+        toExit.run(view);
+        stale = false;
+    }
+
+    if (canKillMinotaur(view)) {
+        return PlayerAction::ATTACK;
+    }
+
+    const Player& player = view.getPlayer();
+    const Cell position = player.getPosition();
+    const MinotaurHerd& minotaurs = view.getMinotaurs();
+    const bool vulnerable = minotaurs.countAlive() > 0 && !player.isImmuneToMinotaur() && !player.hasShieldEffect();
+    if (!vulnerable) {
+        return toExit.stepFrom(position.getRow(), position.getCol());
+    }
+
+    // Distance to the nearest living minotaur
+    auto distanceToMinotaur = [&minotaurs](int row, int col) {
+        int nearest = INT_MAX;
+        for (uint32_t index = 0; index < minotaurs.size(); index++) {
+            if (minotaurs.isAlive(index)) {
+                nearest = std::min(nearest, std::abs(row - minotaurs.getRow(index)) + std::abs(col - minotaurs.getCol(index)));
+            }
+        }
+        return nearest;
+    };
+
+    // Candidates are the four moves and staying in place (index 4)
+    PlayerAction bestSafe = PlayerAction::NONE;
+    uint32_t bestSafeDistance = DistanceField::UNREACHABLE;
+    bool foundSafe = false;
+    PlayerAction bestFlight = PlayerAction::NONE;
+    int bestFlightDistance = -1;
+
+    for (int d = 0; d <= 4; d++) {
+        const int row = position.getRow() + (d < 4 ? DistanceField::ROW_OFFSETS[d] : 0);
+        const int col = position.getCol() + (d < 4 ? DistanceField::COL_OFFSETS[d] : 0);
+        const PlayerAction action = d < 4 ? DistanceField::MOVES[d] : PlayerAction::NONE;
+        if (d < 4 && !view.isWalkable(row, col)) {
+            continue;
+        }
+
+        const int danger = distanceToMinotaur(row, col);
+        if (danger > 1) {
+            const uint32_t distance = toExit.at(row, col);
+            if (!foundSafe || distance < bestSafeDistance) {
+                bestSafe = action;
+                bestSafeDistance = distance;
+                foundSafe = true;
+            }
+        }
+        if (danger > bestFlightDistance) {
+            bestFlight = action;
+            bestFlightDistance = danger;
+        }
+    }
+    return foundSafe ? bestSafe : bestFlight;
+}
@@ -0,0 +1,38 @@
+#include "bots/RandomPolicy.h"
+
+/**
+ * @brief Constructs a RandomPolicy seeded with 0.
+ */
+RandomPolicy::RandomPolicy() : rng(0)
+{
+}
+
+/**
+ * @brief Reseeds the generator for a new game.
+ * 
+ * @param seed Seed of the generator.
+ */
+void RandomPolicy::reset(unsigned int seed)
+{
+    rng.seed(seed);
+}
+
+/**
+ * @brief Chooses a random move, or an attack in one of four ticks while the sword is held.
+ * 
+ * @param view The game being played.
+ * @return PlayerAction The chosen action.
+ */
+PlayerAction RandomPolicy::nextAction(const GameView& view)
+{
+    if (view.getPlayer().hasSwordEffect() && rng() % 4 == 0) {
+        return PlayerAction::ATTACK;
+    }
+
+    switch (rng() % 4) {
+        case 0:  return PlayerAction::UP;
+        case 1:  return PlayerAction::DOWN;
+        case 2:  return PlayerAction::LEFT;
+        default: return PlayerAction::RIGHT;
+    }
+}
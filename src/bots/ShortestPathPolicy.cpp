@@ -0,0 +1,28 @@
+#include "bots/ShortestPathPolicy.h"
+
+/**
+ * @brief Marks the distance field for recomputation; the policy uses no randomness.
+ */
+void ShortestPathPolicy::reset(unsigned int)
+{
+    stale = true;
+}
+
+/**
+ * @brief Steps towards the exit.
+ * 
+ * @param view The game being played.
+ * @return PlayerAction The move along a shortest path, PlayerAction::NONE if the exit is unreachable.
+ */
+PlayerAction ShortestPathPolicy::nextAction(const GameView& view)
+{
+    if (stale) {
+        toExit.begin(view);
+        toExit.addSource(view, view.getExit().getRow(), view.getExit().getCol());
+        toExit.run(view);
+        stale = false;
+    }
+
+    const Cell position = view.getPlayer().getPosition();
+    return toExit.stepFrom(position.getRow(), position.getCol());
+}
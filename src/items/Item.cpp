@@ -1,14 +1,23 @@
 #include "items/Item.h"
 #include "termcolor.hpp"
 
+// Indexed by ItemKind
+static const ItemDescriptor ITEM_DESCRIPTORS[] = {
+    { "Fog of War", "Fog of War effect applied.", "Fog of War effect removed.", "Fog of War effect active." },
+    { "Hummer", "Hummer effect applied.", "Hummer effect removed.", "Hummer effect active." },
+    { "Shield", "Shield effect applied.", "Shield effect removed.", "Shield effect active." },
+    { "Sword", "Sword effect applied.", "Sword effect removed.", "Sword effect active." }
+};
+
 /**
- * @brief Destructor for the Item class.
+ * @brief Retrieves the texts shared by all items of a kind.
  * 
- * @details 
- * Currently does not perform any specific actions as there are no dynamically allocated resources.
+ * @param kind The kind of item.
+ * @return const ItemDescriptor& The static descriptor of the kind.
  */
-Item::~Item()
+const ItemDescriptor& Item::describe(ItemKind kind)
 {
+    return ITEM_DESCRIPTORS[static_cast<std::size_t>(kind)];
 }
 
 /**
@@ -93,7 +102,7 @@ void Item::setUsed()
  * @details 
  * Allows other components to determine whether the item is still available for use or has already been consumed.
  */
-bool Item::isUsed()
+bool Item::isUsed() const
 {
     return used;
 }
@@ -129,32 +138,32 @@ int Item::getEffectDuration() const
  * @brief Displays the informational message associated with the item.
  * 
  * @details 
- * Outputs the `infoMessage` to the console with a yellow background for visibility.
+ * Outputs the info message of the item's kind to the console with a yellow background for visibility.
  * This message typically describes the item's effect or usage instructions.
  */
 void Item::printInfoMessage()
 {
-    std::cout << termcolor::on_yellow << infoMessage << termcolor::reset << std::endl;
+    std::cout << termcolor::on_yellow << getDescriptor().infoMessage << termcolor::reset << std::endl;
 }
 
 /**
  * @brief Displays the message when the player picks up the item.
  * 
  * @details 
- * Outputs the `takeMessage` to the console with a yellow background, informing the player about the successful acquisition of the item.
+ * Outputs the take message of the item's kind to the console with a yellow background, informing the player about the successful acquisition of the item.
  */
 void Item::printTakeMessage()
 {
-    std::cout << termcolor::on_yellow << takeMessage << termcolor::reset << std::endl;
+    std::cout << termcolor::on_yellow << getDescriptor().takeMessage << termcolor::reset << std::endl;
 }
 
 /**
  * @brief Displays the message when the item's effect is removed.
  * 
  * @details 
- * Outputs the `removeMessage` to the console with a yellow background, notifying the player that the item's effect has expired or been deactivated.
+ * Outputs the remove message of the item's kind to the console with a yellow background, notifying the player that the item's effect has expired or been deactivated.
  */
 void Item::printRemoveMessage()
 {
-    std::cout << termcolor::on_yellow << removeMessage << termcolor::reset << std::endl;
+    std::cout << termcolor::on_yellow << getDescriptor().removeMessage << termcolor::reset << std::endl;
 }
\ No newline at end of file
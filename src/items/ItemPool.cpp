@@ -0,0 +1,76 @@
+#include "items/ItemPool.h"
+#include <algorithm>
+
+/**
+ * @brief Destroys all items and makes room for `capacity` new ones.
+ *
+ * @details The slots, the three id arrays and the cell table share one block, allocated
+ *          whenever the pool grows; a pool reset for the same or fewer items reuses its memory.
+ */
+void ItemPool::reset(std::size_t capacity)
+{
+    clear();
+    if (capacity > this->capacity) {
+        std::size_t tableSize = 1;
+        while (tableSize < 2 * capacity) {
+            tableSize *= 2;
+        }
+        const std::size_t idBytes = (3 * capacity + tableSize) * sizeof(uint32_t);
+        const std::size_t idSlots = (idBytes + sizeof(Slot) - 1) / sizeof(Slot);
+        slots.reset(new Slot[capacity + idSlots]);
+        order = reinterpret_cast<uint32_t*>(slots.get() + capacity);
+        orderIndex = order + capacity;
+        cells = orderIndex + capacity;
+        table = cells + capacity;
+        tableMask = static_cast<uint32_t>(tableSize - 1);
+        this->capacity = static_cast<uint32_t>(capacity);
+        std::fill(table, table + tableSize, EMPTY);
+    }
+}
+
+/**
+ * @brief Destroys all items, keeping the memory for reuse.
+ */
+void ItemPool::clear()
+{
+    for (uint32_t id = 0; id < count; id++) {
+        slot(id)->~Item();
+    }
+    if (table) {
+        std::fill(table, table + tableMask + 1, EMPTY);
+    }
+    count = 0;
+    live = 0;
+}
+
+/**
+ * @brief Marks an item as used and moves it out of the range of lying items.
+ *
+ * @param id Id of the item.
+ *
+ * @details The last lying id takes the retired id's place, so the range stays contiguous.
+ */
+void ItemPool::retire(uint32_t id)
+{
+    slot(id)->setUsed();
+
+    const uint32_t index = orderIndex[id];
+    if (index >= live) {
+        return; // Already retired
+    }
+
+    // Free the item's table entry; probing continues past the tombstone
+    if (cells[id] != NO_CELL) {
+        uint32_t entry = home(cells[id]);
+        while (table[entry] != id) {
+            entry = (entry + 1) & tableMask;
+        }
+        table[entry] = TOMBSTONE;
+    }
+    const uint32_t last = --live;
+    const uint32_t moved = order[last];
+    order[index] = moved;
+    orderIndex[moved] = index;
+    order[last] = id;
+    orderIndex[id] = last;
+}
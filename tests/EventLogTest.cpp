@@ -0,0 +1,60 @@
+#include "EventLogTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <fstream>
+#include <string>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(EventLogTest);
+
+void EventLogTest::testRoundTrip() {
+    {
+        EventLog log("eventlog_test.events");
+        CPPUNIT_ASSERT(log.isOpen());
+        // More records than the internal buffer to exercise intermediate writes
+        for (uint32_t i = 0; i < 2000; i++) {
+            log.record(GameEventType::PLAYER_MOVED, i, 1, 2, GameEvent::NO_ITEM, 'w');
+        }
+        log.record(GameEventType::ITEM_ACTIVATED, 2000, 3, 4, 7, 2);
+    }
+
+    std::ifstream in("eventlog_test.events", std::ios::binary);
+    CPPUNIT_ASSERT(EventLog::readHeader(in));
+
+    GameEvent event;
+    uint32_t count = 0;
+    while (in.read(reinterpret_cast<char*>(&event), sizeof(event))) {
+        count++;
+    }
+    CPPUNIT_ASSERT_EQUAL((uint32_t)2001, count);
+
+    // The last record read is the item activation
+    CPPUNIT_ASSERT_EQUAL((uint8_t)GameEventType::ITEM_ACTIVATED, event.type);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)2000, event.tick);
+    CPPUNIT_ASSERT_EQUAL(3, event.row);
+    CPPUNIT_ASSERT_EQUAL(4, event.col);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)7, event.itemId);
+    CPPUNIT_ASSERT_EQUAL((uint8_t)2, event.arg);
+}
+
+void EventLogTest::testInvalidHeader() {
+    {
+        std::ofstream out("eventlog_test_invalid.events", std::ios::binary);
+        out << "not an event log";
+    }
+    std::ifstream in("eventlog_test_invalid.events", std::ios::binary);
+    CPPUNIT_ASSERT(!EventLog::readHeader(in));
+}
+
+void EventLogTest::testDisabledLog() {
+    EventLog log("");
+    CPPUNIT_ASSERT(!log.isOpen());
+    CPPUNIT_ASSERT_NO_THROW(log.record(GameEventType::MINOTAUR_MOVED, 0, 1, 1));
+}
+
+void EventLogTest::testTypeNames() {
+    CPPUNIT_ASSERT_EQUAL(std::string("PLAYER_MOVED"),
+                         std::string(EventLog::typeName((uint8_t)GameEventType::PLAYER_MOVED)));
+    CPPUNIT_ASSERT_EQUAL(std::string("STATE_CHANGED"),
+                         std::string(EventLog::typeName((uint8_t)GameEventType::STATE_CHANGED)));
+    CPPUNIT_ASSERT_EQUAL(std::string("UNKNOWN"), std::string(EventLog::typeName(200)));
+}
@@ -0,0 +1,31 @@
+#ifndef EVENTLOGTEST_H
+#define EVENTLOGTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/EventLog.h"
+
+/**
+ * @brief Test class for the EventLog class.
+ * 
+ * Tests event log functionality including:
+ * - Header validation
+ * - Writing and reading back fixed-size records
+ * - Disabled log with an empty file name
+ */
+class EventLogTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(EventLogTest);
+    CPPUNIT_TEST(testRoundTrip);
+    CPPUNIT_TEST(testInvalidHeader);
+    CPPUNIT_TEST(testDisabledLog);
+    CPPUNIT_TEST(testTypeNames);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testRoundTrip();
+    void testInvalidHeader();
+    void testDisabledLog();
+    void testTypeNames();
+};
+
+#endif // EVENTLOGTEST_H
@@ -0,0 +1,254 @@
+#include "GameBatchTest.h"
+#include "TestGames.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <memory>
+#include <vector>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(GameBatchTest);
+
+void GameBatchTest::setUp() {
+    // First seeded labyrinth whose path leaves room for the minotaur
+    labyrinth = makePlayableLabyrinth(1);
+}
+
+void GameBatchTest::tearDown() {
+    labyrinth.reset();
+}
+
+void GameBatchTest::testSpawn() {
+    GameBatch batch(labyrinth, 64, 7u, 4);
+    CPPUNIT_ASSERT(batch.isReady());
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(64), batch.size());
+
+    const std::list<Cell*> path = labyrinth->getPathFromEntranceToExit();
+    const Cell start = labyrinth->getStartPoint();
+    for (std::size_t game = 0; game < batch.size(); game++) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(Game::PLAYING), static_cast<int>(batch.getState(game)));
+        CPPUNIT_ASSERT_EQUAL(start.getRow() + 1, batch.getPlayerRow(game));
+        CPPUNIT_ASSERT_EQUAL(start.getCol(), batch.getPlayerCol(game));
+
+        bool onPath = false;
+        for (const Cell* cell : path) {
+            onPath = onPath || (cell->getRow() == batch.getMinotaurRow(game) && cell->getCol() == batch.getMinotaurCol(game));
+        }
+        CPPUNIT_ASSERT(onPath);
+
+        for (unsigned int i = 0; i < batch.getItemsPerGame(); i++) {
+            CPPUNIT_ASSERT_EQUAL(static_cast<int>(GameBatch::ITEM_LYING), static_cast<int>(batch.getItemState(game, i)));
+            CPPUNIT_ASSERT_EQUAL(' ', labyrinth->getCell(batch.getItemRow(game, i), batch.getItemCol(game, i)).getVal());
+            for (unsigned int j = 0; j < i; j++) {
+                CPPUNIT_ASSERT(batch.getItemRow(game, i) != batch.getItemRow(game, j) ||
+                               batch.getItemCol(game, i) != batch.getItemCol(game, j));
+            }
+        }
+    }
+
+    // The shared labyrinth is never written
+    CPPUNIT_ASSERT_EQUAL('U', labyrinth->getCell(start.getRow(), start.getCol()).getVal());
+    CPPUNIT_ASSERT_EQUAL(' ', labyrinth->getCell(start.getRow() + 1, start.getCol()).getVal());
+}
+
+void GameBatchTest::testWallsAndQuit() {
+    GameBatch batch(labyrinth, 2, 3u, 0);
+    const int row = batch.getPlayerRow(0);
+
+    // Above the player is the entrance, which cannot be entered
+    std::vector<PlayerAction> actions = { PlayerAction::UP, PlayerAction::QUIT };
+    batch.step(actions.data());
+    CPPUNIT_ASSERT_EQUAL(row, batch.getPlayerRow(0));
+    CPPUNIT_ASSERT_EQUAL(0u, batch.getTurns(0));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(Game::PLAYING), static_cast<int>(batch.getState(0)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(Game::QUIT), static_cast<int>(batch.getState(1)));
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(1), batch.countFinished());
+    CPPUNIT_ASSERT_EQUAL(1u, batch.getTick());
+}
+
+void GameBatchTest::testWalkIntoMinotaur() {
+    // No items and a minotaur that never moves: walking the path must end on its cell
+    GameBatch batch(labyrinth, 1, 5u, 0, 1000000);
+    const std::list<Cell*> path = labyrinth->getPathFromEntranceToExit();
+
+    auto it = path.begin();
+    ++it; // Entrance
+    ++it; // Player's start cell
+    int steps = 0;
+    for (; it != path.end() && batch.getState(0) == Game::PLAYING; ++it, steps++) {
+        const int dr = (*it)->getRow() - batch.getPlayerRow(0);
+        const int dc = (*it)->getCol() - batch.getPlayerCol(0);
+        PlayerAction action = dr < 0 ? PlayerAction::UP : dr > 0 ? PlayerAction::DOWN
+                            : dc < 0 ? PlayerAction::LEFT : PlayerAction::RIGHT;
+        batch.step(&action);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(Game::PLAYER_LOST), static_cast<int>(batch.getState(0)));
+    CPPUNIT_ASSERT_EQUAL(batch.getMinotaurRow(0), batch.getPlayerRow(0));
+    CPPUNIT_ASSERT_EQUAL(batch.getMinotaurCol(0), batch.getPlayerCol(0));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(steps), batch.getTurns(0));
+}
+
+void GameBatchTest::testDeterminism() {
+    GameBatch first(labyrinth, 32, 11u, 4, 2);
+    GameBatch second(labyrinth, 32, 11u, 4, 2);
+
+    std::vector<PlayerAction> actions(32);
+    for (unsigned int t = 0; t < 300; t++) {
+        for (std::size_t game = 0; game < actions.size(); game++) {
+            actions[game] = static_cast<PlayerAction>(1 + (t * 7 + game * 3 + t / 5) % 5); // Moves and attacks
+        }
+        first.step(actions.data());
+        second.step(actions.data());
+    }
+
+    for (std::size_t game = 0; game < first.size(); game++) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(first.getState(game)), static_cast<int>(second.getState(game)));
+        CPPUNIT_ASSERT_EQUAL(first.getPlayerRow(game), second.getPlayerRow(game));
+        CPPUNIT_ASSERT_EQUAL(first.getPlayerCol(game), second.getPlayerCol(game));
+        CPPUNIT_ASSERT_EQUAL(first.getMinotaurRow(game), second.getMinotaurRow(game));
+        CPPUNIT_ASSERT_EQUAL(first.getMinotaurCol(game), second.getMinotaurCol(game));
+        CPPUNIT_ASSERT_EQUAL(first.getTurns(game), second.getTurns(game));
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(first.getEffects(game)), static_cast<int>(second.getEffects(game)));
+    }
+
+    // Resetting with the same seed restarts the same games
+    first.reset(11u);
+    GameBatch fresh(labyrinth, 32, 11u, 4, 2);
+    for (std::size_t game = 0; game < first.size(); game++) {
+        CPPUNIT_ASSERT_EQUAL(fresh.getMinotaurRow(game), first.getMinotaurRow(game));
+        CPPUNIT_ASSERT_EQUAL(fresh.getMinotaurCol(game), first.getMinotaurCol(game));
+        CPPUNIT_ASSERT_EQUAL(fresh.getItemRow(game, 0), first.getItemRow(game, 0));
+    }
+}
+
+void GameBatchTest::testStackedEffectsMatchGame() {
+    // Every game of the batch is mirrored by a Player, which holds the effects of a Game:
+    // each pickup adds its effect for ITEM_EFFECT_DURATION moves and each move expires the
+    // effects that are due. Without attacks the sword and the fog of war are never used up,
+    // so their bits must agree on every tick, also when a second item extends the first.
+    const std::size_t games = 256;
+    GameBatch batch(labyrinth, games, 21u, 12, 1000000);
+    std::vector<Player> mirrors(games);
+    std::vector<uint32_t> lastTurns(games, 0);
+    const uint8_t compared = GameBatch::EFFECT_SWORD | GameBatch::EFFECT_FOG_OF_WAR;
+
+    unsigned int stacked = 0;
+    std::vector<PlayerAction> actions(games);
+    std::vector<uint64_t> walk(games);
+    for (std::size_t game = 0; game < games; game++) {
+        walk[game] = game;
+    }
+    for (unsigned int t = 0; t < 2000 && batch.countFinished() < games; t++) {
+        std::vector<uint8_t> lying(games * batch.getItemsPerGame());
+        for (std::size_t game = 0; game < games; game++) {
+            walk[game] = walk[game] * 6364136223846793005ull + 1442695040888963407ull;
+            actions[game] = static_cast<PlayerAction>(1 + (walk[game] >> 33) % 4); // Random moves only
+            for (unsigned int i = 0; i < batch.getItemsPerGame(); i++) {
+                lying[game * batch.getItemsPerGame() + i] = batch.getItemState(game, i) == GameBatch::ITEM_LYING;
+            }
+        }
+        batch.step(actions.data());
+
+        for (std::size_t game = 0; game < games; game++) {
+            Player& mirror = mirrors[game];
+            const uint32_t turn = batch.getTurns(game);
+            if (turn != lastTurns[game]) {
+                mirror.expireEffects(turn);
+                lastTurns[game] = turn;
+            }
+            for (unsigned int i = 0; i < batch.getItemsPerGame(); i++) {
+                if (lying[game * batch.getItemsPerGame() + i] && batch.getItemState(game, i) == GameBatch::ITEM_ACTIVE) {
+                    const Player::Effect effect = static_cast<Player::Effect>(batch.getItemKind(game, i));
+                    stacked += (mirror.getEffects() & compared & Player::effectBit(effect)) != 0;
+                    mirror.addEffect(effect, turn + GameBatch::ITEM_EFFECT_DURATION);
+                }
+            }
+            CPPUNIT_ASSERT_EQUAL(static_cast<int>(mirror.getEffects() & compared), static_cast<int>(batch.getEffects(game) & compared));
+            if (batch.getEffects(game) & GameBatch::EFFECT_SWORD) {
+                CPPUNIT_ASSERT_EQUAL(mirror.getExpiry(Player::EFFECT_SWORD), batch.getEffectExpiry(game, Player::EFFECT_SWORD));
+            }
+        }
+    }
+    CPPUNIT_ASSERT(stacked > 0);
+}
+
+void GameBatchTest::testMatchesGame() {
+    // Game i of the batch and a Game seeded with GameBatch::gameSeed() play the same actions
+    // and must agree on every entity after every tick, attacks and quitting included
+    const std::size_t games = 256;
+    const unsigned int seed = 17u;
+    GameBatch batch(labyrinth, games, seed, 12, 3);
+    CPPUNIT_ASSERT(batch.isReady());
+
+    std::vector<std::unique_ptr<Game>> reference;
+    for (std::size_t game = 0; game < games; game++) {
+        GameConfig config;
+        config.seed = GameBatch::gameSeed(seed, game);
+        config.numItems = 12;
+        config.minotaurTicks = 3;
+        reference.emplace_back(new Game(labyrinth, config));
+        CPPUNIT_ASSERT(reference.back()->isReady());
+    }
+
+    std::vector<PlayerAction> actions(games);
+    uint64_t walk = 1;
+    unsigned int picked = 0;
+    unsigned int kills = 0;
+    unsigned int walls = 0;
+    for (unsigned int t = 0; t < 1500 && batch.countFinished() < games; t++) {
+        for (std::size_t game = 0; game < games; game++) {
+            walk = walk * 6364136223846793005ull + 1442695040888963407ull;
+            const unsigned int roll = static_cast<unsigned int>(walk >> 33) % 1000;
+            const int dr = batch.getMinotaurRow(game) - batch.getPlayerRow(game);
+            const int dc = batch.getMinotaurCol(game) - batch.getPlayerCol(game);
+            const bool inReach = (batch.getEffects(game) & GameBatch::EFFECT_SWORD) && dr * dr <= 1 && dc * dc <= 1;
+            actions[game] = roll == 0 ? PlayerAction::QUIT
+                          : (inReach && roll < 500) || roll < 50 ? PlayerAction::ATTACK
+                          : roll < 100 ? PlayerAction::NONE
+                          : static_cast<PlayerAction>(1 + roll % 4);
+        }
+        batch.step(actions.data());
+
+        for (std::size_t game = 0; game < games; game++) {
+            Game& mirror = *reference[game];
+            mirror.step(actions[game]);
+
+            const GameView view = mirror.getView();
+            const Player& player = view.getPlayer();
+            const MinotaurHerd& minotaurs = view.getMinotaurs();
+            CPPUNIT_ASSERT_EQUAL(static_cast<int>(mirror.getState()), static_cast<int>(batch.getState(game)));
+            CPPUNIT_ASSERT_EQUAL(player.getPosition().getRow(), batch.getPlayerRow(game));
+            CPPUNIT_ASSERT_EQUAL(player.getPosition().getCol(), batch.getPlayerCol(game));
+            CPPUNIT_ASSERT_EQUAL(mirror.getStats().turns, batch.getTurns(game));
+            walls += labyrinth->getCell(batch.getPlayerRow(game), batch.getPlayerCol(game)).getVal() == '#';
+            CPPUNIT_ASSERT_EQUAL(static_cast<int>(player.getEffects()), static_cast<int>(batch.getEffects(game)));
+            CPPUNIT_ASSERT_EQUAL(minotaurs.isAlive(0), batch.isMinotaurAlive(game));
+            CPPUNIT_ASSERT_EQUAL(minotaurs.getRow(0), batch.getMinotaurRow(game));
+            CPPUNIT_ASSERT_EQUAL(minotaurs.getCol(0), batch.getMinotaurCol(game));
+
+            const ItemPool& items = view.getItems();
+            CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(batch.getItemsPerGame()), items.size());
+            for (unsigned int i = 0; i < batch.getItemsPerGame(); i++) {
+                const Item& item = items[i];
+                const uint32_t cell = static_cast<uint32_t>(item.getPosition().getRow()) * labyrinth->getWidth() +
+                                      static_cast<uint32_t>(item.getPosition().getCol());
+                const GameBatch::ItemState expected = items.at(cell) == static_cast<int>(i) ? GameBatch::ITEM_LYING
+                                                    : item.isActive() ? GameBatch::ITEM_ACTIVE : GameBatch::ITEM_SPENT;
+                CPPUNIT_ASSERT_EQUAL(item.getPosition().getRow(), batch.getItemRow(game, i));
+                CPPUNIT_ASSERT_EQUAL(item.getPosition().getCol(), batch.getItemCol(game, i));
+                CPPUNIT_ASSERT_EQUAL(static_cast<int>(item.getKind()), static_cast<int>(batch.getItemKind(game, i)));
+                CPPUNIT_ASSERT_EQUAL(static_cast<int>(expected), static_cast<int>(batch.getItemState(game, i)));
+            }
+        }
+    }
+
+    // The actions must have exercised the rules being compared
+    for (std::size_t game = 0; game < games; game++) {
+        for (unsigned int i = 0; i < batch.getItemsPerGame(); i++) {
+            picked += batch.getItemState(game, i) == GameBatch::ITEM_ACTIVE || batch.getItemState(game, i) == GameBatch::ITEM_SPENT;
+        }
+        kills += !batch.isMinotaurAlive(game);
+    }
+    CPPUNIT_ASSERT(picked > 0);
+    CPPUNIT_ASSERT(kills > 0);
+    CPPUNIT_ASSERT(walls > 0);
+}
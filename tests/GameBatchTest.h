@@ -0,0 +1,44 @@
+#ifndef GAMEBATCHTEST_H
+#define GAMEBATCHTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/GameBatch.h"
+#include <memory>
+
+/**
+ * @brief Test class for the GameBatch class.
+ * 
+ * Tests batched games including:
+ * - Spawning on the shared labyrinth
+ * - Walls, quitting and losing against the minotaur
+ * - Reproducible games for the same seed and actions
+ * - Stacked effects ending as in Game (the Player effect model)
+ * - Games playing out exactly as Game does for the same seed and actions
+ */
+class GameBatchTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(GameBatchTest);
+    CPPUNIT_TEST(testSpawn);
+    CPPUNIT_TEST(testWallsAndQuit);
+    CPPUNIT_TEST(testWalkIntoMinotaur);
+    CPPUNIT_TEST(testDeterminism);
+    CPPUNIT_TEST(testStackedEffectsMatchGame);
+    CPPUNIT_TEST(testMatchesGame);
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    std::shared_ptr<const Labyrinth> labyrinth;
+
+public:
+    void setUp() override;
+    void tearDown() override;
+
+    void testSpawn();
+    void testWallsAndQuit();
+    void testWalkIntoMinotaur();
+    void testDeterminism();
+    void testStackedEffectsMatchGame();
+    void testMatchesGame();
+};
+
+#endif // GAMEBATCHTEST_H
@@ -6,10 +6,7 @@ CPPUNIT_TEST_SUITE_REGISTRATION(GameTest);
 
 void GameTest::setUp() {
     // Game requires width, height, and numItems parameters
-    game = new Game(15, 15, 5, false); // false = don't start game automatically
-    if (game->getLabyrinth()) {
-        game->getLabyrinth()->setQuietMode(true); // Enable quiet mode for tests
-    }
+    game = new Game(15, 15, 5, false, true); // false = don't start game automatically, true = quiet mode for tests
 }
 
 void GameTest::tearDown() {
@@ -0,0 +1,121 @@
+#include "ItemPoolTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <set>
+#include <string>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(ItemPoolTest);
+
+void ItemPoolTest::testCreate() {
+    ItemPool pool;
+    pool.reset(4);
+    CPPUNIT_ASSERT_EQUAL(0, pool.create<FogOfWar>(Cell(1, 1, ' ')));
+    CPPUNIT_ASSERT_EQUAL(1, pool.create<Hummer>(Cell(1, 2, ' ')));
+    CPPUNIT_ASSERT_EQUAL(2, pool.create<Shield>(Cell(1, 3, ' ')));
+    CPPUNIT_ASSERT_EQUAL(3, pool.create<Sword>(Cell(1, 4, ' ')));
+    CPPUNIT_ASSERT_EQUAL((std::size_t)4, pool.size());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)4, pool.liveCount());
+
+    CPPUNIT_ASSERT(pool[0].getKind() == ItemKind::FOG_OF_WAR);
+    CPPUNIT_ASSERT(pool[1].getKind() == ItemKind::HUMMER);
+    CPPUNIT_ASSERT(pool[2].getKind() == ItemKind::SHIELD);
+    CPPUNIT_ASSERT(pool[3].getKind() == ItemKind::SWORD);
+    CPPUNIT_ASSERT_EQUAL(3, pool[2].getPosition().getCol());
+    CPPUNIT_ASSERT_EQUAL(std::string("Sword"), std::string(pool[3].getDescriptor().name));
+}
+
+void ItemPoolTest::testRetire() {
+    ItemPool pool;
+    pool.reset(3);
+    pool.create<Sword>(Cell(1, 1, ' '));
+    pool.create<Shield>(Cell(1, 2, ' '));
+    pool.create<Hummer>(Cell(1, 3, ' '));
+
+    pool.retire(0);
+    pool.retire(0);
+    CPPUNIT_ASSERT(pool[0].isUsed());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)2, pool.liveCount());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)3, pool.size());
+
+    std::set<uint32_t> lying(pool.lying().begin(), pool.lying().end());
+    CPPUNIT_ASSERT(lying == std::set<uint32_t>({ 1, 2 }));
+
+    // Ids do not move when others are retired
+    pool.retire(2);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)1, pool.lying().size());
+    CPPUNIT_ASSERT_EQUAL((uint32_t)1, *pool.lying().begin());
+    CPPUNIT_ASSERT(pool[1].getKind() == ItemKind::SHIELD);
+}
+
+void ItemPoolTest::testCapacity() {
+    ItemPool pool;
+    pool.reset(1);
+    CPPUNIT_ASSERT_EQUAL(0, pool.create<Shield>(Cell(1, 1, ' ')));
+    CPPUNIT_ASSERT_EQUAL(-1, pool.create<Sword>(Cell(1, 2, ' ')));
+    CPPUNIT_ASSERT_EQUAL((std::size_t)1, pool.size());
+
+    pool.reset(2);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0, pool.size());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0, pool.liveCount());
+    CPPUNIT_ASSERT_EQUAL(0, pool.create<Sword>(Cell(2, 1, ' ')));
+    CPPUNIT_ASSERT_EQUAL(1, pool.create<Hummer>(Cell(2, 2, ' ')));
+    CPPUNIT_ASSERT(pool[0].getKind() == ItemKind::SWORD);
+}
+
+void ItemPoolTest::testCellIndex() {
+    ItemPool pool;
+    pool.reset(64);
+    // A full pool: every item is found on its own cell, however the entries collide
+    for (uint32_t id = 0; id < 64; id++) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(id), pool.create(Sword(Cell(1, 1, ' ')), id * 128));
+    }
+    CPPUNIT_ASSERT_EQUAL(5, pool.at(5 * 128));
+    CPPUNIT_ASSERT_EQUAL(-1, pool.at(7));
+
+    // Retired items are no longer found, the others still are behind their tombstones
+    for (uint32_t id = 0; id < 64; id += 2) {
+        pool.retire(id);
+    }
+    for (uint32_t id = 0; id < 64; id++) {
+        CPPUNIT_ASSERT_EQUAL(id % 2 == 0 ? -1 : static_cast<int>(id), pool.at(id * 128));
+    }
+
+    // A reset empties the index without reallocating
+    pool.reset(8);
+    CPPUNIT_ASSERT_EQUAL(-1, pool.at(3 * 128));
+    CPPUNIT_ASSERT_EQUAL(0, pool.create(Hummer(Cell(2, 2, ' ')), 3 * 128));
+    CPPUNIT_ASSERT_EQUAL(0, pool.at(3 * 128));
+    CPPUNIT_ASSERT_EQUAL(3u * 128, pool.cellOf(0));
+    CPPUNIT_ASSERT_EQUAL(ItemPool::NO_CELL, pool.cellOf(pool.create(Sword(Cell(1, 1, ' ')))));
+}
+
+void ItemPoolTest::testEffects() {
+    Player player;
+    ItemPool pool;
+    pool.reset(4);
+    pool.create(Item(ItemKind::SWORD, Cell(1, 1, ' ')));
+    pool.create(Item(ItemKind::SHIELD, Cell(1, 2, ' ')));
+    pool.create<Hummer>(Cell(1, 3, ' '));
+    pool.create<FogOfWar>(Cell(1, 4, ' '));
+
+    pool[0].applyEffect(player);
+    pool[1].applyEffect(player);
+    CPPUNIT_ASSERT(player.hasSwordEffect());
+    CPPUNIT_ASSERT(player.hasShieldEffect());
+    CPPUNIT_ASSERT(!player.hasHummerEffect());
+    CPPUNIT_ASSERT(!player.hasFogOfWarEffect());
+
+    pool[2].applyEffect(player);
+    pool[3].applyEffect(player);
+    pool[0].removeEffect(player);
+    CPPUNIT_ASSERT(!player.hasSwordEffect());
+    CPPUNIT_ASSERT(player.hasShieldEffect());
+    CPPUNIT_ASSERT(player.hasHummerEffect());
+    CPPUNIT_ASSERT(player.hasFogOfWarEffect());
+
+    // Items are plain values: a copy keeps its kind and effect
+    Item copy = pool[1];
+    copy.removeEffect(player);
+    CPPUNIT_ASSERT(!player.hasShieldEffect());
+    CPPUNIT_ASSERT_EQUAL(std::string("Shield"), std::string(copy.getDescriptor().name));
+}
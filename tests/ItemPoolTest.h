@@ -0,0 +1,35 @@
+#ifndef ITEMPOOLTEST_H
+#define ITEMPOOLTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/items/ItemPool.h"
+
+/**
+ * @brief Test class for the ItemPool class.
+ * 
+ * Tests item storage including:
+ * - Stable ids and per-kind descriptors of created items
+ * - Retiring items out of the range of lying items
+ * - Refusing items beyond the capacity and reuse after reset
+ * - Looking up lying items by cell
+ * - Applying and removing the effect selected by the item kind
+ */
+class ItemPoolTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(ItemPoolTest);
+    CPPUNIT_TEST(testCreate);
+    CPPUNIT_TEST(testRetire);
+    CPPUNIT_TEST(testCapacity);
+    CPPUNIT_TEST(testCellIndex);
+    CPPUNIT_TEST(testEffects);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testCreate();
+    void testRetire();
+    void testCapacity();
+    void testCellIndex();
+    void testEffects();
+};
+
+#endif // ITEMPOOLTEST_H
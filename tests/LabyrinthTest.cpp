@@ -1,5 +1,8 @@
 #include "LabyrinthTest.h"
 #include <cppunit/extensions/HelperMacros.h>
+#include <algorithm>
+#include <fstream>
+#include <type_traits>
 
 // Register the test suite
 CPPUNIT_TEST_SUITE_REGISTRATION(LabyrinthTest);
@@ -76,6 +79,12 @@ void LabyrinthTest::testCellAccess() {
     testLabyrinth.setCell(5, 5, testCell);
     Cell& retrievedCell = testLabyrinth.getCell(5, 5);
     CPPUNIT_ASSERT_EQUAL('T', retrievedCell.getVal());
+
+    // A const labyrinth only hands out const cells; the same cell is reached through both overloads
+    const Labyrinth& constLabyrinth = testLabyrinth;
+    static_assert(std::is_same<decltype(constLabyrinth.getCell(0, 0)), const Cell&>::value,
+                  "getCell() const must not expose mutable cells");
+    CPPUNIT_ASSERT(&constLabyrinth.getCell(5, 5) == &retrievedCell);
 }
 
 void LabyrinthTest::testBoundaryValidation() {
@@ -165,3 +174,224 @@ void LabyrinthTest::testMapValidation() {
         CPPUNIT_ASSERT(hasPaths); // Should have some paths
     }
 }
+
+void LabyrinthTest::testSaveAndLoadFromFile() {
+    Labyrinth original(21, 21, true);
+
+    if (original.getMapGenerationSuccess()) {
+        // Game objects saved with the map must be loaded back as floor
+        Cell start = original.getStartPoint();
+        original.getCell(start.getRow() + 1, start.getCol()).setVal('R');
+        original.saveToFile("labyrinth_test_save.txt");
+        original.getCell(start.getRow() + 1, start.getCol()).setVal(' ');
+
+        Labyrinth loaded(std::string("labyrinth_test_save.txt"), true);
+        CPPUNIT_ASSERT(loaded.getMapGenerationSuccess());
+        CPPUNIT_ASSERT_EQUAL(original.getWidth(), loaded.getWidth());
+        CPPUNIT_ASSERT_EQUAL(original.getHeight(), loaded.getHeight());
+        CPPUNIT_ASSERT(original.getStartPoint() == loaded.getStartPoint());
+        CPPUNIT_ASSERT(original.getEndPoint() == loaded.getEndPoint());
+
+        for (unsigned int i = 0; i < loaded.getHeight(); i++) {
+            for (unsigned int j = 0; j < loaded.getWidth(); j++) {
+                CPPUNIT_ASSERT_EQUAL(original.getCell(i, j).getVal(), loaded.getCell(i, j).getVal());
+                CPPUNIT_ASSERT_EQUAL((int)i, loaded.getCell(i, j).getRow());
+                CPPUNIT_ASSERT_EQUAL((int)j, loaded.getCell(i, j).getCol());
+            }
+        }
+
+        // The path is recomputed on load
+        CPPUNIT_ASSERT_EQUAL(original.getPathFromEntranceToExit().size(),
+                             loaded.getPathFromEntranceToExit().size());
+    }
+}
+
+void LabyrinthTest::testLoadInvalidFile() {
+    Labyrinth missing(std::string("labyrinth_test_missing.txt"), true);
+    CPPUNIT_ASSERT(!missing.getMapGenerationSuccess());
+
+    // Rows of different length are rejected
+    {
+        std::ofstream file("labyrinth_test_ragged.txt");
+        file << "#U###\n#  #\n###I#\n";
+    }
+    Labyrinth ragged(std::string("labyrinth_test_ragged.txt"), true);
+    CPPUNIT_ASSERT(!ragged.getMapGenerationSuccess());
+
+    // A map without an exit is rejected
+    {
+        std::ofstream file("labyrinth_test_noexit.txt");
+        file << "#U###\n#   #\n#####\n";
+    }
+    Labyrinth noExit(std::string("labyrinth_test_noexit.txt"), true);
+    CPPUNIT_ASSERT(!noExit.getMapGenerationSuccess());
+}
+
+void LabyrinthTest::testSaveAndLoadBinaryFile() {
+    Labyrinth original(61, 41, true);
+
+    if (original.getMapGenerationSuccess()) {
+        for (bool runLength : {false, true}) {
+            const std::string filename = runLength ? "labyrinth_test_rle.bin" : "labyrinth_test_plain.bin";
+            CPPUNIT_ASSERT(original.saveToBinaryFile(filename, runLength));
+
+            Labyrinth loaded(filename, true);
+            CPPUNIT_ASSERT(loaded.getMapGenerationSuccess());
+            CPPUNIT_ASSERT_EQUAL(original.getWidth(), loaded.getWidth());
+            CPPUNIT_ASSERT_EQUAL(original.getHeight(), loaded.getHeight());
+            CPPUNIT_ASSERT_EQUAL(original.getSeed(), loaded.getSeed());
+            CPPUNIT_ASSERT(original.getStartPoint() == loaded.getStartPoint());
+            CPPUNIT_ASSERT(original.getEndPoint() == loaded.getEndPoint());
+
+            for (unsigned int i = 0; i < loaded.getHeight(); i++) {
+                for (unsigned int j = 0; j < loaded.getWidth(); j++) {
+                    CPPUNIT_ASSERT_EQUAL(original.getCell(i, j).getVal(), loaded.getCell(i, j).getVal());
+                }
+            }
+            CPPUNIT_ASSERT_EQUAL(original.getPathFromEntranceToExit().size(),
+                                 loaded.getPathFromEntranceToExit().size());
+        }
+
+        // The plain wall plane takes one bit per cell
+        std::ifstream plain("labyrinth_test_plain.bin", std::ios::binary | std::ios::ate);
+        std::size_t expected = sizeof(LabyrinthFileHeader) + ((61 + 7) / 8) * 41;
+        CPPUNIT_ASSERT_EQUAL(expected, static_cast<std::size_t>(plain.tellg()));
+    }
+}
+
+void LabyrinthTest::testLoadCorruptedBinaryFile() {
+    Labyrinth original(21, 21, true);
+
+    if (original.getMapGenerationSuccess()) {
+        CPPUNIT_ASSERT(original.saveToBinaryFile("labyrinth_test_corrupt.bin"));
+
+        // Flip one bit of the wall plane: the checksum no longer matches
+        {
+            std::fstream file("labyrinth_test_corrupt.bin", std::ios::in | std::ios::out | std::ios::binary);
+            file.seekg(sizeof(LabyrinthFileHeader) + 5);
+            char byte = 0;
+            file.read(&byte, 1);
+            byte ^= 0x10;
+            file.seekp(sizeof(LabyrinthFileHeader) + 5);
+            file.write(&byte, 1);
+        }
+        Labyrinth corrupted(std::string("labyrinth_test_corrupt.bin"), true);
+        CPPUNIT_ASSERT(!corrupted.getMapGenerationSuccess());
+
+        // A truncated file is rejected as well
+        {
+            std::ofstream file("labyrinth_test_truncated.bin", std::ios::binary);
+            file.write("LBYB", 4);
+        }
+        Labyrinth truncated(std::string("labyrinth_test_truncated.bin"), true);
+        CPPUNIT_ASSERT(!truncated.getMapGenerationSuccess());
+    }
+}
+
+void LabyrinthTest::testGenerationStats() {
+    Labyrinth generated(31, 31, true);
+    const GenerationStats& stats = generated.getGenerationStats();
+
+    CPPUNIT_ASSERT(stats.attempts >= 1);
+    CPPUNIT_ASSERT_EQUAL(stats.attempts - (generated.getMapGenerationSuccess() ? 1u : 0u),
+                         stats.noPathFailures + stats.wallConditionFailures);
+    CPPUNIT_ASSERT(stats.bfsCellsVisited > 0);
+    CPPUNIT_ASSERT(stats.peakScratchBytes > 0);
+    CPPUNIT_ASSERT(stats.totalNs >= stats.resetNs + stats.ellerNs + stats.semicircleNs +
+                                    stats.pathCheckNs + stats.wallConditionNs + stats.findPathNs);
+
+    // Loaded labyrinths are not generated
+    if (generated.getMapGenerationSuccess()) {
+        CPPUNIT_ASSERT(generated.saveToBinaryFile("labyrinth_test_stats.bin"));
+        Labyrinth loaded(std::string("labyrinth_test_stats.bin"), true);
+        CPPUNIT_ASSERT_EQUAL(0u, loaded.getGenerationStats().attempts);
+    }
+}
+
+void LabyrinthTest::testSeededGeneration() {
+    Labyrinth first(21, 21, true, 12345u);
+    Labyrinth second(21, 21, true, 12345u);
+
+    CPPUNIT_ASSERT_EQUAL(12345u, first.getSeed());
+    CPPUNIT_ASSERT_EQUAL(first.getMapGenerationSuccess(), second.getMapGenerationSuccess());
+    CPPUNIT_ASSERT_EQUAL(first.getGenerationStats().attempts, second.getGenerationStats().attempts);
+    for (unsigned int r = 0; r < first.getHeight(); r++) {
+        for (unsigned int c = 0; c < first.getWidth(); c++) {
+            CPPUNIT_ASSERT_EQUAL(first.getCell(r, c).getVal(), second.getCell(r, c).getVal());
+        }
+    }
+}
+
+void LabyrinthTest::testOpenMasks() {
+    Labyrinth testLabyrinth(21, 21, true, 777u);
+    CPPUNIT_ASSERT(testLabyrinth.getMapGenerationSuccess());
+
+    // Every mask matches the neighbours in the grid
+    auto expectedMask = [&](int r, int c) {
+        uint8_t mask = 0;
+        for (int d = 0; d < Labyrinth::DIRECTION_COUNT; d++) {
+            const int nr = r + Labyrinth::DIRECTION_ROW[d];
+            const int nc = c + Labyrinth::DIRECTION_COL[d];
+            if (nr >= 0 && nr < 21 && nc >= 0 && nc < 21 && testLabyrinth.getCell(nr, nc).getVal() != '#') {
+                mask |= 1u << d;
+            }
+        }
+        return mask;
+    };
+    for (int r = 0; r < 21; r++) {
+        for (int c = 0; c < 21; c++) {
+            CPPUNIT_ASSERT_EQUAL(expectedMask(r, c), testLabyrinth.getOpenMask(r, c));
+        }
+    }
+
+    // setCell() updates the masks of the neighbours
+    testLabyrinth.setCell(5, 5, Cell(5, 5, '#'));
+    CPPUNIT_ASSERT(!(testLabyrinth.getOpenMask(4, 5) & (1u << Labyrinth::DIRECTION_DOWN)));
+    CPPUNIT_ASSERT(!(testLabyrinth.getOpenMask(5, 6) & (1u << Labyrinth::DIRECTION_LEFT)));
+    testLabyrinth.setCell(5, 5, Cell(5, 5, ' '));
+    CPPUNIT_ASSERT(testLabyrinth.getOpenMask(6, 5) & (1u << Labyrinth::DIRECTION_UP));
+    CPPUNIT_ASSERT(testLabyrinth.getOpenMask(5, 4) & (1u << Labyrinth::DIRECTION_RIGHT));
+    CPPUNIT_ASSERT_EQUAL(expectedMask(5, 5), testLabyrinth.getOpenMask(5, 5));
+
+    // Direction helpers
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(1u << Labyrinth::DIRECTION_UP), Labyrinth::directionBit(30, 9, 21));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(1u << Labyrinth::DIRECTION_RIGHT), Labyrinth::directionBit(30, 31, 21));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(0), Labyrinth::directionBit(20, 21, 21)); // Row wrap
+    CPPUNIT_ASSERT_EQUAL(Labyrinth::DIRECTION_LEFT, Labyrinth::nthDirection(0x0D, 1));
+    CPPUNIT_ASSERT_EQUAL(Labyrinth::DIRECTION_RIGHT, Labyrinth::nthDirection(0x0D, 2));
+    CPPUNIT_ASSERT_EQUAL(std::string("\u253C"), std::string(Labyrinth::wallGlyph(0x0F)));
+    CPPUNIT_ASSERT_EQUAL(std::string("\u2500"), std::string(Labyrinth::wallGlyph(0x0C)));
+}
+
+void LabyrinthTest::testFloorCells() {
+    Labyrinth testLabyrinth(21, 21, true, 777u);
+    CPPUNIT_ASSERT(testLabyrinth.getMapGenerationSuccess());
+
+    // Every empty cell is listed once, in row-major order
+    std::vector<uint32_t> expected;
+    for (uint32_t r = 0; r < 21; r++) {
+        for (uint32_t c = 0; c < 21; c++) {
+            if (testLabyrinth.getCell(r, c).getVal() == ' ') {
+                expected.push_back(r * 21 + c);
+            }
+        }
+    }
+    CPPUNIT_ASSERT(expected == testLabyrinth.getFloorCells());
+
+    // The reachable cells are a sorted subset that contains the whole path to the exit
+    const std::vector<uint32_t>& reachable = testLabyrinth.getReachableFloorCells();
+    CPPUNIT_ASSERT(!reachable.empty());
+    CPPUNIT_ASSERT(std::is_sorted(reachable.begin(), reachable.end()));
+    CPPUNIT_ASSERT(std::includes(expected.begin(), expected.end(), reachable.begin(), reachable.end()));
+    for (const Cell* cell : testLabyrinth.getPathFromEntranceToExit()) {
+        if (cell->getVal() == ' ') {
+            CPPUNIT_ASSERT(std::binary_search(reachable.begin(), reachable.end(), static_cast<uint32_t>(cell->getRow() * 21 + cell->getCol())));
+        }
+    }
+
+    // setCell() keeps the lists current
+    const uint32_t first = expected.front();
+    testLabyrinth.setCell(first / 21, first % 21, Cell(first / 21, first % 21, '#'));
+    CPPUNIT_ASSERT_EQUAL(expected.size() - 1, testLabyrinth.getFloorCells().size());
+    CPPUNIT_ASSERT(!std::binary_search(testLabyrinth.getReachableFloorCells().begin(), testLabyrinth.getReachableFloorCells().end(), first));
+}
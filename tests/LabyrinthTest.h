@@ -14,6 +14,9 @@
  * - Path finding
  * - Cell access and modification
  * - Validation of entrance and exit
+ * - Saving to and loading from files
+ * - Open-direction masks and wall glyphs
+ * - Lists of floor cells shared by the games
  */
 class LabyrinthTest : public CPPUNIT_NS::TestFixture {
     CPPUNIT_TEST_SUITE(LabyrinthTest);
@@ -25,6 +28,14 @@ class LabyrinthTest : public CPPUNIT_NS::TestFixture {
     CPPUNIT_TEST(testEntranceAndExit);
     CPPUNIT_TEST(testPathFinding);
     CPPUNIT_TEST(testMapValidation);
+    CPPUNIT_TEST(testSaveAndLoadFromFile);
+    CPPUNIT_TEST(testLoadInvalidFile);
+    CPPUNIT_TEST(testSaveAndLoadBinaryFile);
+    CPPUNIT_TEST(testLoadCorruptedBinaryFile);
+    CPPUNIT_TEST(testGenerationStats);
+    CPPUNIT_TEST(testSeededGeneration);
+    CPPUNIT_TEST(testOpenMasks);
+    CPPUNIT_TEST(testFloorCells);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -42,6 +53,14 @@ public:
     void testEntranceAndExit();
     void testPathFinding();
     void testMapValidation();
+    void testSaveAndLoadFromFile();
+    void testLoadInvalidFile();
+    void testSaveAndLoadBinaryFile();
+    void testLoadCorruptedBinaryFile();
+    void testGenerationStats();
+    void testSeededGeneration();
+    void testOpenMasks();
+    void testFloorCells();
 };
 
 #endif // LABYRINTHTEST_H
@@ -0,0 +1,158 @@
+#include "LoggerTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(LoggerTest);
+
+// Reads all lines of a file written by the logger
+static std::vector<std::string> readLines(const std::string& filename) {
+    std::vector<std::string> lines;
+    std::ifstream file(filename);
+    std::string line;
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+void LoggerTest::testSyncLogging() {
+    {
+        Logger logger("logger_test_sync.log");
+        CPPUNIT_ASSERT(!logger.isAsync());
+        logger.log("first message");
+        logger.save("raw message");
+    }
+
+    std::vector<std::string> lines = readLines("logger_test_sync.log");
+    CPPUNIT_ASSERT_EQUAL((size_t)2, lines.size());
+    CPPUNIT_ASSERT(lines[0].front() == '[');
+    CPPUNIT_ASSERT(lines[0].find("] first message") != std::string::npos);
+    CPPUNIT_ASSERT_EQUAL(std::string("raw message"), lines[1]);
+}
+
+void LoggerTest::testAsyncLoggingWritesAllRecords() {
+    LoggerOptions options;
+    options.async = true;
+    options.flushPolicy = FlushPolicy::ON_EXIT;
+    options.ringCapacity = 512;
+
+    {
+        Logger logger("logger_test_async.log", options);
+        CPPUNIT_ASSERT(logger.isAsync());
+        for (int i = 0; i < 300; i++) {
+            logger.log("message " + std::to_string(i));
+        }
+    } // Destructor drains the ring
+
+    std::vector<std::string> lines = readLines("logger_test_async.log");
+    CPPUNIT_ASSERT_EQUAL((size_t)300, lines.size());
+    CPPUNIT_ASSERT(lines.front().find("] message 0") != std::string::npos);
+    CPPUNIT_ASSERT(lines.back().find("] message 299") != std::string::npos);
+}
+
+void LoggerTest::testAsyncFlush() {
+    LoggerOptions options;
+    options.async = true;
+    options.flushPolicy = FlushPolicy::ON_EXIT;
+
+    Logger logger("logger_test_flush.log", options);
+    logger.log("before flush");
+    logger.flush();
+
+    // The file is readable while the logger is still alive
+    std::vector<std::string> lines = readLines("logger_test_flush.log");
+    CPPUNIT_ASSERT_EQUAL((size_t)1, lines.size());
+    CPPUNIT_ASSERT(lines[0].find("before flush") != std::string::npos);
+}
+
+void LoggerTest::testAsyncSaveWithoutTimestamp() {
+    LoggerOptions options;
+    options.async = true;
+
+    {
+        Logger logger("logger_test_save.log", options);
+        logger.save("plain line");
+        logger.log(std::string(Logger::MAX_MESSAGE_LENGTH + 50, 'x'));
+    }
+
+    std::vector<std::string> lines = readLines("logger_test_save.log");
+    CPPUNIT_ASSERT_EQUAL((size_t)2, lines.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("plain line"), lines[0]);
+    // Over-long messages are truncated to the record size
+    CPPUNIT_ASSERT_EQUAL(Logger::MAX_MESSAGE_LENGTH, lines[1].size() - lines[1].find("] ") - 2);
+}
+
+void LoggerTest::testAsyncRingOverflow() {
+    LoggerOptions options;
+    options.async = true;
+    options.flushPolicy = FlushPolicy::ON_EXIT;
+    options.flushInterval = std::chrono::milliseconds(10000); // Keep the writer asleep
+    options.ringCapacity = 4;
+
+    {
+        Logger logger("logger_test_overflow.log", options);
+        for (int i = 0; i < 20; i++) {
+            logger.log("message " + std::to_string(i));
+        }
+        // The producer never blocks: records beyond the ring capacity are dropped
+        CPPUNIT_ASSERT(logger.getDroppedRecords() > 0);
+    }
+
+    std::vector<std::string> lines = readLines("logger_test_overflow.log");
+    CPPUNIT_ASSERT(lines.size() < 20);
+    CPPUNIT_ASSERT(lines.back().find("dropped") != std::string::npos);
+}
+
+void LoggerTest::testLevelThreshold() {
+    {
+        Logger logger("logger_test_levels.log");
+        logger.setLevel(LogLevel::INFO);
+        CPPUNIT_ASSERT(!logger.isEnabled(LogLevel::TRACE));
+        CPPUNIT_ASSERT(!logger.isEnabled(LogLevel::DEBUG));
+        CPPUNIT_ASSERT(logger.isEnabled(LogLevel::INFO));
+        CPPUNIT_ASSERT(logger.isEnabled(LogLevel::WARN));
+
+        logger.log("trace message", LogLevel::TRACE);
+        LOG_DEBUG(logger, "debug message");
+        LOG_INFO(logger, "info message");
+        LOG_WARN(logger, "warn message");
+
+        logger.setLevel(LogLevel::OFF);
+        LOG_WARN(logger, "suppressed message");
+    }
+
+    std::vector<std::string> lines = readLines("logger_test_levels.log");
+    CPPUNIT_ASSERT_EQUAL((size_t)2, lines.size());
+    CPPUNIT_ASSERT(lines[0].find("info message") != std::string::npos);
+    CPPUNIT_ASSERT(lines[1].find("warn message") != std::string::npos);
+}
+
+void LoggerTest::testLazyMessageConstruction() {
+    LoggerOptions options;
+    options.level = LogLevel::WARN;
+    Logger logger("logger_test_lazy.log", options);
+
+    int evaluations = 0;
+    auto buildMessage = [&evaluations]() {
+        evaluations++;
+        return std::string("expensive message");
+    };
+
+    // Disabled level: the message expression must not be evaluated
+    LOG_TRACE(logger, buildMessage());
+    CPPUNIT_ASSERT_EQUAL(0, evaluations);
+
+    LOG_WARN(logger, buildMessage());
+    CPPUNIT_ASSERT_EQUAL(1, evaluations);
+}
+
+void LoggerTest::testParseLevel() {
+    CPPUNIT_ASSERT(Logger::parseLevel("trace", LogLevel::INFO) == LogLevel::TRACE);
+    CPPUNIT_ASSERT(Logger::parseLevel("DEBUG", LogLevel::INFO) == LogLevel::DEBUG);
+    CPPUNIT_ASSERT(Logger::parseLevel("Warn", LogLevel::INFO) == LogLevel::WARN);
+    CPPUNIT_ASSERT(Logger::parseLevel("off", LogLevel::INFO) == LogLevel::OFF);
+    CPPUNIT_ASSERT(Logger::parseLevel("verbose", LogLevel::INFO) == LogLevel::INFO);
+}
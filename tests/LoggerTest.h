@@ -0,0 +1,41 @@
+#ifndef LOGGERTEST_H
+#define LOGGERTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/Logger.h"
+
+/**
+ * @brief Test class for the Logger class.
+ * 
+ * Tests logger functionality including:
+ * - Synchronous logging with timestamps
+ * - Asynchronous logging through the background writer
+ * - Explicit flush and flush policies
+ * - Dropping records when the ring is full
+ * - Log levels and lazy message construction
+ */
+class LoggerTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(LoggerTest);
+    CPPUNIT_TEST(testSyncLogging);
+    CPPUNIT_TEST(testAsyncLoggingWritesAllRecords);
+    CPPUNIT_TEST(testAsyncFlush);
+    CPPUNIT_TEST(testAsyncSaveWithoutTimestamp);
+    CPPUNIT_TEST(testAsyncRingOverflow);
+    CPPUNIT_TEST(testLevelThreshold);
+    CPPUNIT_TEST(testLazyMessageConstruction);
+    CPPUNIT_TEST(testParseLevel);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testSyncLogging();
+    void testAsyncLoggingWritesAllRecords();
+    void testAsyncFlush();
+    void testAsyncSaveWithoutTimestamp();
+    void testAsyncRingOverflow();
+    void testLevelThreshold();
+    void testLazyMessageConstruction();
+    void testParseLevel();
+};
+
+#endif // LOGGERTEST_H
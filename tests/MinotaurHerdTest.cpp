@@ -0,0 +1,123 @@
+#include "MinotaurHerdTest.h"
+#include "../include/Minotaur.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <vector>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(MinotaurHerdTest);
+
+void MinotaurHerdTest::testOccupancy() {
+    MinotaurHerd herd;
+    herd.reset(10);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)0, herd.add(12));
+    CPPUNIT_ASSERT_EQUAL((uint32_t)1, herd.add(12));
+    CPPUNIT_ASSERT_EQUAL((uint32_t)2, herd.add(35));
+    CPPUNIT_ASSERT_EQUAL((std::size_t)3, herd.size());
+    CPPUNIT_ASSERT_EQUAL(1, herd.getRow(0));
+    CPPUNIT_ASSERT_EQUAL(2, herd.getCol(0));
+
+    // Two minotaurs share a cell: it stays occupied until both left
+    CPPUNIT_ASSERT(herd.isOccupied(12));
+    herd.moveTo(0, 13);
+    CPPUNIT_ASSERT(herd.isOccupied(12));
+    CPPUNIT_ASSERT(herd.isOccupied(13));
+    herd.moveTo(1, 22);
+    CPPUNIT_ASSERT(!herd.isOccupied(12));
+    CPPUNIT_ASSERT_EQUAL(1, herd.findAt(22));
+    CPPUNIT_ASSERT_EQUAL(-1, herd.findAt(12));
+
+    // reset() empties the herd and the grid
+    herd.reset(10);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0, herd.size());
+    CPPUNIT_ASSERT(!herd.isOccupied(13));
+}
+
+void MinotaurHerdTest::testKill() {
+    MinotaurHerd herd;
+    herd.reset(10);
+    herd.add(40);
+    herd.add(40);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)2, herd.countAlive());
+    CPPUNIT_ASSERT_EQUAL(0, herd.findAt(40));
+
+    herd.kill(0);
+    herd.kill(0); // No effect
+    CPPUNIT_ASSERT_EQUAL((std::size_t)1, herd.countAlive());
+    CPPUNIT_ASSERT(!herd.isAlive(0));
+    CPPUNIT_ASSERT_EQUAL(1, herd.findAt(40));
+
+    // A dead minotaur keeps its index but no longer occupies cells
+    herd.moveTo(0, 41);
+    CPPUNIT_ASSERT(!herd.isOccupied(41));
+    herd.kill(1);
+    CPPUNIT_ASSERT(!herd.isOccupied(40));
+    CPPUNIT_ASSERT_EQUAL((std::size_t)2, herd.size());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0, herd.countAlive());
+}
+
+void MinotaurHerdTest::testLargeHerd() {
+    // Past the scan limit the herd answers from its table; it must agree with a full grid
+    const uint32_t width = 40;
+    const uint32_t area = width * width;
+    MinotaurHerd herd;
+    herd.reset(width);
+    std::vector<uint32_t> grid(area, 0);
+    uint32_t state = 12345u;
+    auto next = [&]() { state = state * 1664525u + 1013904223u; return state >> 8; };
+    for (uint32_t i = 0; i < 200; i++) {
+        const uint32_t cell = next() % area;
+        herd.add(cell);
+        grid[cell]++;
+    }
+
+    // Minotaurs walk, die and pile up on cells; every answer matches the counts
+    for (uint32_t round = 0; round < 5000; round++) {
+        const uint32_t index = next() % 200;
+        if (round % 97 == 0) {
+            if (herd.isAlive(index)) {
+                grid[herd.getCell(index)]--;
+            }
+            herd.kill(index);
+        } else {
+            const uint32_t cell = next() % 64; // A small area, so cells share minotaurs
+            if (herd.isAlive(index)) {
+                grid[herd.getCell(index)]--;
+                grid[cell]++;
+            }
+            herd.moveTo(index, cell);
+        }
+    }
+    for (uint32_t cell = 0; cell < area; cell++) {
+        CPPUNIT_ASSERT_EQUAL(grid[cell] != 0, herd.isOccupied(cell));
+        const int found = herd.findAt(cell);
+        CPPUNIT_ASSERT_EQUAL(grid[cell] != 0, found >= 0);
+        if (found >= 0) {
+            CPPUNIT_ASSERT_EQUAL(cell, herd.getCell(static_cast<uint32_t>(found)));
+            CPPUNIT_ASSERT(herd.isAlive(static_cast<uint32_t>(found)));
+        }
+    }
+
+    herd.reset(width);
+    CPPUNIT_ASSERT(!herd.isOccupied(0));
+    herd.add(7);
+    CPPUNIT_ASSERT(herd.isOccupied(7));
+}
+
+void MinotaurHerdTest::testHandle() {
+    MinotaurHerd herd;
+    herd.reset(10);
+    Minotaur first(&herd, 0);
+    CPPUNIT_ASSERT(!first.isAlive()); // Not spawned yet
+
+    herd.add(15);
+    CPPUNIT_ASSERT(first.isAlive());
+    CPPUNIT_ASSERT(first.getPosition() == Cell(1, 5, ' '));
+
+    first.setPosition(Cell(3, 4, 'M'));
+    CPPUNIT_ASSERT_EQUAL((uint32_t)34, herd.getCell(0));
+    CPPUNIT_ASSERT(herd.isOccupied(34));
+
+    first.kill();
+    CPPUNIT_ASSERT(!herd.isAlive(0));
+    CPPUNIT_ASSERT(!first.isAlive());
+}
@@ -0,0 +1,32 @@
+#ifndef MINOTAURHERDTEST_H
+#define MINOTAURHERDTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/MinotaurHerd.h"
+
+/**
+ * @brief Test class for the MinotaurHerd class.
+ * 
+ * Tests the minotaur herd including:
+ * - Adding and moving minotaurs with the occupancy following
+ * - Large herds answering from their sparse occupancy table
+ * - Killing minotaurs and finding the living ones on a cell
+ * - Minotaur handles reading and writing the herd
+ */
+class MinotaurHerdTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(MinotaurHerdTest);
+    CPPUNIT_TEST(testOccupancy);
+    CPPUNIT_TEST(testKill);
+    CPPUNIT_TEST(testLargeHerd);
+    CPPUNIT_TEST(testHandle);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testOccupancy();
+    void testKill();
+    void testLargeHerd();
+    void testHandle();
+};
+
+#endif // MINOTAURHERDTEST_H
@@ -0,0 +1,99 @@
+#include "ObservationTest.h"
+#include "../include/Game.h"
+#include "../include/GameBatch.h"
+#include "TestGames.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <memory>
+#include <vector>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(ObservationTest);
+
+void ObservationTest::testGameWindow() {
+    std::unique_ptr<Game> game = makePlayableGame(3);
+    const int radius = 2;
+    const int side = 2 * radius + 1;
+    std::vector<uint8_t> window(observationSize(radius), 0xFF);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::size_t>(3 * side * side), window.size());
+
+    fillObservation(game->getView(), radius, window.data());
+
+    // The player starts right below the entrance on the top border
+    const Cell player = game->getPlayer()->getPosition();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(TerrainCode::FLOOR), window[radius * side + radius]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(TerrainCode::ENTRANCE), window[(radius - 1) * side + radius]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(TerrainCode::OUTSIDE), window[0]);
+
+    for (int wr = 0; wr < side; wr++) {
+        for (int wc = 0; wc < side; wc++) {
+            const int row = player.getRow() - radius + wr;
+            const int col = player.getCol() - radius + wc;
+            if (row >= 0 && row < 21 && col >= 0 && col < 21) {
+                const char val = game->getLabyrinth()->getCell(row, col).getVal();
+                CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(terrainCodeOf(val)), window[wr * side + wc]);
+            } else {
+                CPPUNIT_ASSERT_EQUAL(static_cast<uint8_t>(TerrainCode::OUTSIDE), window[wr * side + wc]);
+            }
+        }
+    }
+}
+
+void ObservationTest::testEntityChannels() {
+    std::unique_ptr<Game> game = makePlayableGame(5);
+
+    // A window covering the whole labyrinth sees every entity
+    const int radius = 21;
+    const int side = 2 * radius + 1;
+    const std::size_t plane = static_cast<std::size_t>(side) * side;
+    std::vector<uint8_t> window(observationSize(radius));
+    fillObservation(game->getView(), radius, window.data());
+
+    const Cell player = game->getPlayer()->getPosition();
+    auto index = [&](const Cell& cell) {
+        return (cell.getRow() - player.getRow() + radius) * side + (cell.getCol() - player.getCol() + radius);
+    };
+
+    unsigned int minotaurs = 0;
+    unsigned int items = 0;
+    for (std::size_t i = 0; i < plane; i++) {
+        minotaurs += window[CHANNEL_MINOTAUR * plane + i];
+        items += window[CHANNEL_ITEMS * plane + i] != 0;
+    }
+    CPPUNIT_ASSERT_EQUAL(1u, minotaurs);
+    CPPUNIT_ASSERT_EQUAL(1, static_cast<int>(window[CHANNEL_MINOTAUR * plane + index(game->getMinotaur()->getPosition())]));
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned int>(game->getView().getItems().size()), items);
+    const ItemPool& pool = game->getView().getItems();
+    for (uint32_t id = 0; id < pool.size(); id++) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(pool[id].getKind()) + 1,
+                             static_cast<int>(window[CHANNEL_ITEMS * plane + index(pool[id].getPosition())]));
+    }
+}
+
+void ObservationTest::testBatchWindows() {
+    std::shared_ptr<const Labyrinth> labyrinth = makePlayableLabyrinth(1);
+
+    GameBatch batch(labyrinth, 16, 9u, 4);
+    const int radius = 3;
+    const int side = 2 * radius + 1;
+    const std::size_t stride = observationSize(radius);
+    const std::size_t plane = static_cast<std::size_t>(side) * side;
+    std::vector<uint8_t> windows(batch.size() * stride);
+    batch.observe(radius, windows.data());
+
+    for (std::size_t game = 0; game < batch.size(); game++) {
+        const uint8_t* window = windows.data() + game * stride;
+        for (int wr = 0; wr < side; wr++) {
+            for (int wc = 0; wc < side; wc++) {
+                const int row = batch.getPlayerRow(game) - radius + wr;
+                const int col = batch.getPlayerCol(game) - radius + wc;
+                const uint8_t expected = (row >= 0 && row < 21 && col >= 0 && col < 21)
+                    ? static_cast<uint8_t>(terrainCodeOf(labyrinth->getCell(row, col).getVal()))
+                    : static_cast<uint8_t>(TerrainCode::OUTSIDE);
+                CPPUNIT_ASSERT_EQUAL(expected, window[wr * side + wc]);
+
+                const bool minotaurHere = row == batch.getMinotaurRow(game) && col == batch.getMinotaurCol(game);
+                CPPUNIT_ASSERT_EQUAL(minotaurHere ? 1 : 0, static_cast<int>(window[CHANNEL_MINOTAUR * plane + wr * side + wc]));
+            }
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef OBSERVATIONTEST_H
+#define OBSERVATIONTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/Observation.h"
+
+/**
+ * @brief Test class for the observation windows.
+ * 
+ * Tests observations including:
+ * - Terrain codes around the player of a game, with cells outside the labyrinth
+ * - Minotaur and item channels
+ * - Batched windows matching the single-game ones
+ */
+class ObservationTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(ObservationTest);
+    CPPUNIT_TEST(testGameWindow);
+    CPPUNIT_TEST(testEntityChannels);
+    CPPUNIT_TEST(testBatchWindows);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testGameWindow();
+    void testEntityChannels();
+    void testBatchWindows();
+};
+
+#endif // OBSERVATIONTEST_H
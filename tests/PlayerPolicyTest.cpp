@@ -0,0 +1,139 @@
+#include "PlayerPolicyTest.h"
+#include "../include/bots/DistanceField.h"
+#include "../include/bots/ItemGreedyPolicy.h"
+#include "../include/bots/MinotaurAvoidingPolicy.h"
+#include "../include/bots/ShortestPathPolicy.h"
+#include "TestGames.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <cstdlib>
+#include <memory>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(PlayerPolicyTest);
+
+// Creates the first playable seeded game at or after `seed`
+static std::unique_ptr<Game> makeGame(unsigned int seed, unsigned int minotaurTicks = 20) {
+    GameConfig config;
+    config.numItems = 4;
+    config.minotaurTicks = minotaurTicks;
+    return makePlayableGame(seed, config);
+}
+
+static void applyMove(PlayerAction action, int& row, int& col) {
+    switch (action) {
+        case PlayerAction::UP:    row--; break;
+        case PlayerAction::DOWN:  row++; break;
+        case PlayerAction::LEFT:  col--; break;
+        case PlayerAction::RIGHT: col++; break;
+        default: break;
+    }
+}
+
+void PlayerPolicyTest::testDistanceField() {
+    std::unique_ptr<Game> game = makeGame(11);
+    GameView view = game->getView();
+    const Cell exit = view.getExit();
+
+    DistanceField field;
+    field.begin(view);
+    field.addSource(view, exit.getRow(), exit.getCol());
+    field.run(view);
+
+    CPPUNIT_ASSERT_EQUAL(0u, field.at(exit.getRow(), exit.getCol()));
+    CPPUNIT_ASSERT(PlayerAction::NONE == field.stepFrom(exit.getRow(), exit.getCol()));
+    CPPUNIT_ASSERT_EQUAL(DistanceField::UNREACHABLE, field.at(-1, 0));
+    CPPUNIT_ASSERT_EQUAL(DistanceField::UNREACHABLE, field.at(0, 0)); // Corner wall
+
+    // Every reachable cell has a neighbour one step closer to the exit
+    for (int r = 0; r < view.getHeight(); r++) {
+        for (int c = 0; c < view.getWidth(); c++) {
+            uint32_t distance = field.at(r, c);
+            if (distance == DistanceField::UNREACHABLE || distance == 0) {
+                continue;
+            }
+            int row = r, col = c;
+            applyMove(field.stepFrom(r, c), row, col);
+            CPPUNIT_ASSERT_EQUAL(distance - 1, field.at(row, col));
+        }
+    }
+}
+
+void PlayerPolicyTest::testShortestPathReachesExit() {
+    std::unique_ptr<Game> game = makeGame(21);
+    game->getMinotaur()->kill(); // Only the route is tested here
+
+    const Cell start = game->getPlayer()->getPosition();
+    DistanceField field;
+    GameView view = game->getView();
+    field.begin(view);
+    field.addSource(view, view.getExit().getRow(), view.getExit().getCol());
+    field.run(view);
+    const uint32_t shortest = field.at(start.getRow(), start.getCol());
+    CPPUNIT_ASSERT(shortest != DistanceField::UNREACHABLE);
+
+    ShortestPathPolicy policy;
+    policy.reset(0);
+    while (!game->isFinished() && game->getTick() < 10 * shortest) {
+        game->step(policy.nextAction(game->getView()));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(Game::PLAYER_WON), static_cast<int>(game->getState()));
+    CPPUNIT_ASSERT_EQUAL(shortest, game->getStats().turns);
+}
+
+void PlayerPolicyTest::testItemGreedyCollectsItems() {
+    std::unique_ptr<Game> game = makeGame(31);
+    game->getMinotaur()->kill(); // Keep every item on the map
+
+    // Walls can enclose items, only those reachable from the start are expected
+    GameView view = game->getView();
+    const Cell start = view.getPlayer().getPosition();
+    DistanceField fromStart;
+    fromStart.begin(view);
+    fromStart.addSource(view, start.getRow(), start.getCol());
+    fromStart.run(view);
+    unsigned int reachable = 0;
+    for (uint32_t id : view.getItems().lying()) {
+        const Cell position = view.getItems()[id].getPosition();
+        if (fromStart.at(position.getRow(), position.getCol()) != DistanceField::UNREACHABLE) {
+            reachable++;
+        }
+    }
+
+    ItemGreedyPolicy policy;
+    policy.reset(0);
+    while (!game->isFinished() && game->getTick() < 5000) {
+        game->step(policy.nextAction(game->getView()));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<int>(Game::PLAYER_WON), static_cast<int>(game->getState()));
+    const GameStats& stats = game->getStats();
+    CPPUNIT_ASSERT_EQUAL(reachable, stats.pickups[0] + stats.pickups[1] + stats.pickups[2] + stats.pickups[3]);
+}
+
+void PlayerPolicyTest::testMinotaurAvoidingKeepsDistance() {
+    // The minotaur moves every tick so the bot has to evade it often
+    std::unique_ptr<Game> game = makeGame(41, 1);
+    MinotaurAvoidingPolicy policy;
+    policy.reset(0);
+
+    while (!game->isFinished() && game->getTick() < 2000) {
+        GameView view = game->getView();
+        const PlayerAction action = policy.nextAction(view);
+
+        const Player& player = view.getPlayer();
+        const Cell position = player.getPosition();
+        const Cell minotaur = view.getMinotaur().getPosition();
+        const int distance = std::abs(position.getRow() - minotaur.getRow()) + std::abs(position.getCol() - minotaur.getCol());
+        const bool vulnerable = view.getMinotaur().isAlive() && !player.isImmuneToMinotaur() && !player.hasShieldEffect();
+
+        // Waiting is safe here, so the bot must not walk into the minotaur's reach
+        if (vulnerable && distance >= 3) {
+            int row = position.getRow(), col = position.getCol();
+            applyMove(action, row, col);
+            CPPUNIT_ASSERT(std::abs(row - minotaur.getRow()) + std::abs(col - minotaur.getCol()) >= 2);
+        }
+        game->step(action);
+    }
+    CPPUNIT_ASSERT(game->getTick() > 0);
+}
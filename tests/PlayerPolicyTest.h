@@ -0,0 +1,32 @@
+#ifndef PLAYERPOLICYTEST_H
+#define PLAYERPOLICYTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/Game.h"
+
+/**
+ * @brief Test class for the automated player policies.
+ * 
+ * Tests bot functionality including:
+ * - Distances of the shared distance field
+ * - The shortest-path runner reaching the exit in the minimum number of moves
+ * - The item-greedy bot collecting every item before leaving
+ * - The minotaur-avoiding bot staying out of the minotaur's reach
+ */
+class PlayerPolicyTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(PlayerPolicyTest);
+    CPPUNIT_TEST(testDistanceField);
+    CPPUNIT_TEST(testShortestPathReachesExit);
+    CPPUNIT_TEST(testItemGreedyCollectsItems);
+    CPPUNIT_TEST(testMinotaurAvoidingKeepsDistance);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testDistanceField();
+    void testShortestPathReachesExit();
+    void testItemGreedyCollectsItems();
+    void testMinotaurAvoidingKeepsDistance();
+};
+
+#endif // PLAYERPOLICYTEST_H
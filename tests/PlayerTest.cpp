@@ -119,3 +119,30 @@ void PlayerTest::testEffectToggling() {
     CPPUNIT_ASSERT(!player->hasHummerEffect());
     CPPUNIT_ASSERT(!player->hasFogOfWarEffect());
 }
+
+void PlayerTest::testEffectExpiry() {
+    player->addEffect(Player::EFFECT_SWORD, 5);
+    player->addEffect(Player::EFFECT_IMMUNITY, 3);
+    player->addHummerEffect(); // Lasts until it is used
+    CPPUNIT_ASSERT_EQUAL((int)(Player::effectBit(Player::EFFECT_SWORD) | Player::effectBit(Player::EFFECT_IMMUNITY) |
+                               Player::effectBit(Player::EFFECT_HUMMER)), (int)player->getEffects());
+    CPPUNIT_ASSERT(player->isImmuneToMinotaur());
+
+    // A second sword extends the effect, an earlier end does not shorten it
+    player->addEffect(Player::EFFECT_SWORD, 8);
+    player->addEffect(Player::EFFECT_SWORD, 6);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)8, player->getExpiry(Player::EFFECT_SWORD));
+
+    CPPUNIT_ASSERT_EQUAL(0, (int)player->expiringBy(2));
+    CPPUNIT_ASSERT_EQUAL((int)Player::effectBit(Player::EFFECT_IMMUNITY), (int)player->expireEffects(3));
+    CPPUNIT_ASSERT(!player->isImmuneToMinotaur());
+    CPPUNIT_ASSERT_EQUAL(0, (int)player->expireEffects(5));
+    CPPUNIT_ASSERT(player->hasSwordEffect());
+    CPPUNIT_ASSERT_EQUAL((int)Player::effectBit(Player::EFFECT_SWORD), (int)player->expireEffects(8));
+    CPPUNIT_ASSERT(!player->hasSwordEffect());
+    CPPUNIT_ASSERT(player->hasHummerEffect());
+
+    // A removed effect starts over when it is added again
+    player->addEffect(Player::EFFECT_SWORD, 10);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)10, player->getExpiry(Player::EFFECT_SWORD));
+}
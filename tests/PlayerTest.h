@@ -13,6 +13,7 @@
  * - Effect status (sword, shield, hammer, fog of war)
  * - Immunity system
  * - Item application
+ * - Effect mask, stacking and expiry turns
  */
 class PlayerTest : public CPPUNIT_NS::TestFixture {
     CPPUNIT_TEST_SUITE(PlayerTest);
@@ -22,6 +23,7 @@ class PlayerTest : public CPPUNIT_NS::TestFixture {
     CPPUNIT_TEST(testImmunitySystem);
     CPPUNIT_TEST(testMovePlayer);
     CPPUNIT_TEST(testEffectToggling);
+    CPPUNIT_TEST(testEffectExpiry);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -37,6 +39,7 @@ public:
     void testImmunitySystem();
     void testMovePlayer();
     void testEffectToggling();
+    void testEffectExpiry();
 };
 
 #endif // PLAYERTEST_H
@@ -0,0 +1,169 @@
+#include "ReplayTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <fstream>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(ReplayTest);
+
+static std::streamoff fileSize(const char* filename) {
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    return in.tellg();
+}
+
+void ReplayTest::testRoundTrip() {
+    ReplayHeader header;
+    header.width = 31;
+    header.height = 25;
+    header.labyrinthSeed = 4000000000u;
+    header.seed = 77;
+    header.numItems = 6;
+    header.minotaurTicks = 20;
+    header.minotaurCount = 3;
+    header.chasingMinotaurs = true;
+    header.labyrinthFile = "maps/arena.lab";
+    {
+        ReplayWriter writer;
+        CPPUNIT_ASSERT(writer.open("replay_test.replay", header));
+        writer.record(0, 2);
+        writer.record(3, 0);        // PlayerAction::NONE is not recorded
+        writer.record(3, 4);
+        writer.record(100000, 5);
+        writer.finish(100007);
+    }
+
+    ReplayReader reader("replay_test.replay");
+    CPPUNIT_ASSERT(reader.isValid());
+    CPPUNIT_ASSERT_EQUAL((uint32_t)31, reader.getHeader().width);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)25, reader.getHeader().height);
+    CPPUNIT_ASSERT_EQUAL(4000000000u, reader.getHeader().labyrinthSeed);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)77, reader.getHeader().seed);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)6, reader.getHeader().numItems);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)3, reader.getHeader().minotaurCount);
+    CPPUNIT_ASSERT(reader.getHeader().chasingMinotaurs);
+    CPPUNIT_ASSERT(!reader.getHeader().reachableItemsOnly);
+    CPPUNIT_ASSERT_EQUAL(std::string("maps/arena.lab"), reader.getHeader().labyrinthFile);
+
+    const uint32_t ticks[] = { 0, 3, 100000 };
+    const uint8_t actions[] = { 2, 4, 5 };
+    uint32_t tick;
+    uint8_t action;
+    for (int i = 0; i < 3; i++) {
+        CPPUNIT_ASSERT(reader.next(tick, action));
+        CPPUNIT_ASSERT_EQUAL(ticks[i], tick);
+        CPPUNIT_ASSERT_EQUAL(actions[i], action);
+    }
+    CPPUNIT_ASSERT(!reader.next(tick, action));
+    CPPUNIT_ASSERT(reader.hasEnded());
+    CPPUNIT_ASSERT_EQUAL((uint32_t)100007, reader.getEndTick());
+}
+
+void ReplayTest::testCompactRecords() {
+    ReplayHeader header;
+    header.width = 21;
+    header.height = 21;
+    header.seed = 1;
+    std::streamoff headerSize;
+    {
+        ReplayWriter writer;
+        writer.open("replay_test_header.replay", header);
+    }
+    headerSize = fileSize("replay_test_header.replay");
+
+    // Moves at most 15 ticks apart take one byte each, the END record one more
+    {
+        ReplayWriter writer;
+        writer.open("replay_test_compact.replay", header);
+        for (uint32_t move = 0; move < 1000; move++) {
+            writer.record(move * 15, 1 + move % 4);
+        }
+        writer.finish(15000);
+    }
+    CPPUNIT_ASSERT_EQUAL(headerSize + 1001, fileSize("replay_test_compact.replay"));
+}
+
+void ReplayTest::testUnfinishedAndInvalid() {
+    ReplayHeader header;
+    header.width = 21;
+    header.height = 21;
+    {
+        // Destroyed without finish(): the buffered records are written, without an END record
+        ReplayWriter writer;
+        writer.open("replay_test_unfinished.replay", header);
+        writer.record(9, 3);
+    }
+    ReplayReader unfinished("replay_test_unfinished.replay");
+    uint32_t tick;
+    uint8_t action;
+    CPPUNIT_ASSERT(unfinished.next(tick, action));
+    CPPUNIT_ASSERT_EQUAL((uint32_t)9, tick);
+    CPPUNIT_ASSERT(!unfinished.next(tick, action));
+    CPPUNIT_ASSERT(!unfinished.hasEnded());
+
+    {
+        std::ofstream out("replay_test_invalid.replay", std::ios::binary);
+        out << "LBEV garbage";
+    }
+    ReplayReader invalid("replay_test_invalid.replay");
+    CPPUNIT_ASSERT(!invalid.isValid());
+    CPPUNIT_ASSERT(!invalid.next(tick, action));
+
+    ReplayReader missing("replay_test_missing.replay");
+    CPPUNIT_ASSERT(!missing.isValid());
+
+    // An empty name disables recording
+    ReplayWriter disabled;
+    CPPUNIT_ASSERT(!disabled.open("", header));
+    CPPUNIT_ASSERT(!disabled.isOpen());
+}
+
+// Header of a version 2 replay up to, not including, the labyrinth file name length
+static void writeHeaderStart(std::ofstream& out) {
+    const char start[] = { 'L', 'B', 'R', 'P', 2, 21, 21, 0, 1, 0, 0, 0, 0 };
+    out.write(start, sizeof(start));
+}
+
+void ReplayTest::testFileNameLength() {
+    {
+        // 0xFFFFFFFF: above MAX_FILE_NAME
+        std::ofstream out("replay_test_huge_name.replay", std::ios::binary);
+        writeHeaderStart(out);
+        const char length[] = { '\xFF', '\xFF', '\xFF', '\xFF', '\x0F' };
+        out.write(length, sizeof(length));
+        out << "maps";
+    }
+    ReplayReader huge("replay_test_huge_name.replay");
+    CPPUNIT_ASSERT(!huge.isValid());
+
+    {
+        // 100: below MAX_FILE_NAME but longer than the rest of the file
+        std::ofstream out("replay_test_short_name.replay", std::ios::binary);
+        writeHeaderStart(out);
+        out.put(100);
+        out << "maps";
+    }
+    ReplayReader truncated("replay_test_short_name.replay");
+    CPPUNIT_ASSERT(!truncated.isValid());
+
+    {
+        // 4: exactly the rest of the file
+        std::ofstream out("replay_test_exact_name.replay", std::ios::binary);
+        writeHeaderStart(out);
+        out.put(4);
+        out << "maps";
+    }
+    ReplayReader exact("replay_test_exact_name.replay");
+    CPPUNIT_ASSERT(exact.isValid());
+    CPPUNIT_ASSERT_EQUAL(std::string("maps"), exact.getHeader().labyrinthFile);
+
+    // The writer only stores names the reader accepts
+    ReplayHeader header;
+    header.labyrinthFile = std::string(ReplayWriter::MAX_FILE_NAME + 1, 'a');
+    ReplayWriter writer;
+    CPPUNIT_ASSERT(!writer.open("replay_test_long_name.replay", header));
+    header.labyrinthFile.pop_back();
+    CPPUNIT_ASSERT(writer.open("replay_test_long_name.replay", header));
+    writer.finish(0);
+    ReplayReader longest("replay_test_long_name.replay");
+    CPPUNIT_ASSERT(longest.isValid());
+    CPPUNIT_ASSERT_EQUAL(header.labyrinthFile, longest.getHeader().labyrinthFile);
+}
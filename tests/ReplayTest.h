@@ -0,0 +1,31 @@
+#ifndef REPLAYTEST_H
+#define REPLAYTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/Replay.h"
+
+/**
+ * @brief Test class for the ReplayWriter and ReplayReader classes.
+ * 
+ * Tests the replay file format including:
+ * - Round trip of the header and the (tick, action) records
+ * - Size of the records
+ * - Unfinished and invalid files
+ */
+class ReplayTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(ReplayTest);
+    CPPUNIT_TEST(testRoundTrip);
+    CPPUNIT_TEST(testCompactRecords);
+    CPPUNIT_TEST(testUnfinishedAndInvalid);
+    CPPUNIT_TEST(testFileNameLength);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testRoundTrip();
+    void testCompactRecords();
+    void testUnfinishedAndInvalid();
+    void testFileNameLength();
+};
+
+#endif // REPLAYTEST_H
@@ -0,0 +1,50 @@
+#include "SimClockTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <chrono>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(SimClockTest);
+
+void SimClockTest::testOffsets() {
+    using std::chrono::milliseconds;
+
+    // At speed 1 a second holds TICKS_PER_SECOND ticks
+    SimClock realTime;
+    CPPUNIT_ASSERT(realTime.isPaced());
+    CPPUNIT_ASSERT(realTime.offsetOf(0) == SimClock::Clock::duration::zero());
+    CPPUNIT_ASSERT(realTime.offsetOf(SimClock::TICKS_PER_SECOND) == std::chrono::duration_cast<SimClock::Clock::duration>(milliseconds(1000)));
+
+    // A sped-up clock divides every deadline by its speed
+    SimClock fast(10.0);
+    CPPUNIT_ASSERT(fast.offsetOf(200) == std::chrono::duration_cast<SimClock::Clock::duration>(milliseconds(1000)));
+}
+
+void SimClockTest::testUnpaced() {
+    SimClock unpaced(0.0);
+    CPPUNIT_ASSERT(!unpaced.isPaced());
+    CPPUNIT_ASSERT(unpaced.offsetOf(1000000) == SimClock::Clock::duration::zero());
+
+    // Negative speeds are treated as unpaced
+    SimClock negative(-3.0);
+    CPPUNIT_ASSERT(!negative.isPaced());
+    CPPUNIT_ASSERT_EQUAL(0.0, negative.getSpeed());
+
+    const auto start = SimClock::Clock::now();
+    unpaced.start();
+    unpaced.waitForTick(1000000);
+    CPPUNIT_ASSERT(SimClock::Clock::now() - start < std::chrono::milliseconds(100));
+}
+
+void SimClockTest::testWaitForTick() {
+    // 40 ticks at 100x are 20 ms of wall time
+    SimClock clock(100.0);
+    clock.start();
+    const auto start = SimClock::Clock::now();
+    clock.waitForTick(40);
+    CPPUNIT_ASSERT(SimClock::Clock::now() - start >= std::chrono::milliseconds(19));
+
+    // A tick that is already due returns at once
+    const auto late = SimClock::Clock::now();
+    clock.waitForTick(1);
+    CPPUNIT_ASSERT(SimClock::Clock::now() - late < std::chrono::milliseconds(10));
+}
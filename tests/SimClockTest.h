@@ -0,0 +1,29 @@
+#ifndef SIMCLOCKTEST_H
+#define SIMCLOCKTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/SimClock.h"
+
+/**
+ * @brief Test class for the SimClock class.
+ * 
+ * Tests the simulation clock including:
+ * - Tick deadlines at real time and sped up
+ * - Unpaced clocks never waiting
+ * - Waiting for a tick at a high speed-up
+ */
+class SimClockTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(SimClockTest);
+    CPPUNIT_TEST(testOffsets);
+    CPPUNIT_TEST(testUnpaced);
+    CPPUNIT_TEST(testWaitForTick);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testOffsets();
+    void testUnpaced();
+    void testWaitForTick();
+};
+
+#endif // SIMCLOCKTEST_H
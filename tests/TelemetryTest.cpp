@@ -0,0 +1,101 @@
+#include "TelemetryTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <fstream>
+#include <string>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(TelemetryTest);
+
+void TelemetryTest::testPercentiles() {
+    LatencyHistogram histogram;
+    // 1..1000 microseconds
+    for (uint64_t us = 1; us <= 1000; us++) {
+        histogram.record(us * 1000);
+    }
+
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1000, histogram.count());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1000000, histogram.max());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)500500, histogram.mean());
+
+    // Reported values are bucket upper bounds: never below the exact value, at most 1/16 above
+    const double percents[] = { 50, 95, 99 };
+    for (double percent : percents) {
+        double exact = percent * 10 * 1000;
+        double reported = static_cast<double>(histogram.percentile(percent));
+        CPPUNIT_ASSERT(reported >= exact);
+        CPPUNIT_ASSERT(reported <= exact * (1.0 + 1.0 / LatencyHistogram::SUB_BUCKETS));
+    }
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1000000, histogram.percentile(100));
+
+    // Small values are exact
+    LatencyHistogram small;
+    small.record(3);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)3, small.percentile(50));
+}
+
+void TelemetryTest::testEmptyAndReset() {
+    LatencyHistogram histogram;
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0, histogram.percentile(99));
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0, histogram.mean());
+
+    histogram.record(12345);
+    histogram.reset();
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0, histogram.count());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0, histogram.percentile(50));
+}
+
+void TelemetryTest::testSaveReport() {
+    FrameTelemetry telemetry;
+    telemetry.record(FramePhase::RENDER, 2000000);
+    telemetry.record(FramePhase::FRAME, 52000000);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1, telemetry.get(FramePhase::RENDER).count());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0, telemetry.get(FramePhase::SLEEP).count());
+
+    CPPUNIT_ASSERT(telemetry.save("telemetry_test.log"));
+
+    // Header plus one line per phase
+    std::ifstream in("telemetry_test.log");
+    std::string line;
+    int lines = 0;
+    bool foundRender = false;
+    while (std::getline(in, line)) {
+        lines++;
+        if (line.rfind("render", 0) == 0) {
+            foundRender = line.find("2000.0") != std::string::npos;
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL(1 + static_cast<int>(FramePhase::COUNT), lines);
+    CPPUNIT_ASSERT(foundRender);
+}
+
+void TelemetryTest::testRollingWindow() {
+    const uint64_t second = RollingLatencyHistogram::SLOT_NANOS;
+    RollingLatencyHistogram rolling;
+
+    // A stall in the first second, then fast frames
+    rolling.record(500000000, 0);
+    for (uint64_t t = 1; t < 30; t++) {
+        rolling.record(1000, t * second);
+    }
+    CPPUNIT_ASSERT_EQUAL((uint64_t)RollingLatencyHistogram::WINDOW_SLOTS, rolling.window(29 * second).count());
+    CPPUNIT_ASSERT(rolling.window(29 * second).max() < 2000);
+
+    // While the stall is in the window it dominates p99
+    RollingLatencyHistogram early;
+    early.record(500000000, 0);
+    early.record(1000, second);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)500000000, early.window(2 * second).max());
+
+    // Without new samples the window still moves on
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1, early.window(10 * second).count());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0, early.window(11 * second).count());
+
+    // FrameTelemetry keeps both: the whole game and the recent seconds
+    FrameTelemetry telemetry;
+    telemetry.record(FramePhase::FRAME, 500000000);
+    telemetry.setTime(60 * second);
+    telemetry.record(FramePhase::FRAME, 50000000);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)2, telemetry.get(FramePhase::FRAME).count());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1, telemetry.recent(FramePhase::FRAME).count());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)50000000, telemetry.recent(FramePhase::FRAME).max());
+}
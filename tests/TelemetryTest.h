@@ -0,0 +1,32 @@
+#ifndef TELEMETRYTEST_H
+#define TELEMETRYTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/Telemetry.h"
+
+/**
+ * @brief Test class for LatencyHistogram and FrameTelemetry.
+ * 
+ * Tests telemetry functionality including:
+ * - Percentiles within the bucket precision
+ * - Empty histograms and reset
+ * - Writing the per-phase report
+ * - Rolling windows dropping old samples
+ */
+class TelemetryTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(TelemetryTest);
+    CPPUNIT_TEST(testPercentiles);
+    CPPUNIT_TEST(testEmptyAndReset);
+    CPPUNIT_TEST(testSaveReport);
+    CPPUNIT_TEST(testRollingWindow);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testPercentiles();
+    void testEmptyAndReset();
+    void testSaveReport();
+    void testRollingWindow();
+};
+
+#endif // TELEMETRYTEST_H
@@ -0,0 +1,61 @@
+#ifndef TESTGAMES_H
+#define TESTGAMES_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/Game.h"
+#include "../include/Labyrinth.h"
+#include <memory>
+#include <string>
+
+/**
+ * @brief Fixture factories shared by the test suites.
+ *
+ * Not every seed yields a labyrinth whose path leaves room for the minotaur, so the
+ * factories try a bounded number of consecutive seeds and fail the test if none of
+ * them is playable, instead of searching forever.
+ */
+
+/**
+ * @brief Consecutive seeds tried before a fixture factory fails the test.
+ */
+constexpr unsigned int MAX_SEED_ATTEMPTS = 64;
+
+/**
+ * @brief Creates the first playable seeded game at or after `seed`.
+ *
+ * @param seed First seed tried.
+ * @param config Settings of the game; its seed is replaced.
+ * @return std::unique_ptr<Game> A game for which isReady() holds.
+ */
+inline std::unique_ptr<Game> makePlayableGame(unsigned int seed, GameConfig config = GameConfig()) {
+    for (unsigned int attempt = 0; attempt < MAX_SEED_ATTEMPTS; attempt++) {
+        config.seed = seed + attempt;
+        std::unique_ptr<Game> game(new Game(config));
+        if (game->isReady()) {
+            return game;
+        }
+    }
+    CPPUNIT_FAIL("No playable game for seeds " + std::to_string(seed) + " to " + std::to_string(seed + MAX_SEED_ATTEMPTS - 1));
+    return nullptr;
+}
+
+/**
+ * @brief Generates the first seeded labyrinth at or after `seed` whose path leaves room for the minotaur.
+ *
+ * @param seed First seed tried.
+ * @param width Width of the labyrinth.
+ * @param height Height of the labyrinth.
+ * @return std::shared_ptr<const Labyrinth> A labyrinth games can be spawned on.
+ */
+inline std::shared_ptr<const Labyrinth> makePlayableLabyrinth(unsigned int seed, unsigned int width = 21, unsigned int height = 21) {
+    for (unsigned int attempt = 0; attempt < MAX_SEED_ATTEMPTS; attempt++) {
+        std::shared_ptr<const Labyrinth> labyrinth(new Labyrinth(width, height, true, seed + attempt));
+        if (labyrinth->getMapGenerationSuccess() && labyrinth->getPathFromEntranceToExit().size() >= 14) {
+            return labyrinth;
+        }
+    }
+    CPPUNIT_FAIL("No playable labyrinth for seeds " + std::to_string(seed) + " to " + std::to_string(seed + MAX_SEED_ATTEMPTS - 1));
+    return nullptr;
+}
+
+#endif // TESTGAMES_H
@@ -0,0 +1,96 @@
+#include "TimerWheelTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(TimerWheelTest);
+
+void TimerWheelTest::testFireAtDeadline() {
+    TimerWheel wheel;
+    wheel.schedule(3, 0, 1);
+    wheel.schedule(2, 0, 2);
+    wheel.schedule(3, 0, 3);
+    wheel.schedule(0, 0, 4); // Not after the current time: fires at time 1
+    CPPUNIT_ASSERT_EQUAL((std::size_t)4, wheel.pending());
+
+    std::vector<std::pair<uint64_t, uint32_t>> fired;
+    auto record = [&](const TimerWheel::Timer& timer) { fired.emplace_back(timer.deadline, timer.id); };
+
+    wheel.advance(1, record);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)1, fired.size());
+    CPPUNIT_ASSERT_EQUAL((uint32_t)4, fired[0].second);
+
+    wheel.advance(2, record);
+    wheel.advance(2, record);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)2, fired.size());
+    CPPUNIT_ASSERT_EQUAL((uint32_t)2, fired[1].second);
+
+    wheel.advance(10, record);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)4, fired.size());
+    CPPUNIT_ASSERT_EQUAL((uint32_t)1, fired[2].second);
+    CPPUNIT_ASSERT_EQUAL((uint32_t)3, fired[3].second);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)3, fired[3].first);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0, wheel.pending());
+    CPPUNIT_ASSERT_EQUAL((uint64_t)10, wheel.getTime());
+}
+
+void TimerWheelTest::testFarDeadlines() {
+    TimerWheel wheel;
+    wheel.reset(100);
+    const uint64_t deadlines[] = { 164, 4196, 262244, 16777316, 50000000000ull };
+    for (uint64_t deadline : deadlines) {
+        wheel.schedule(deadline, 1, static_cast<uint32_t>(deadline % 1000));
+    }
+
+    std::vector<uint64_t> fired;
+    for (uint64_t deadline : deadlines) {
+        wheel.advance(deadline - 1, [&](const TimerWheel::Timer& timer) { fired.push_back(timer.deadline); });
+        CPPUNIT_ASSERT(std::find(fired.begin(), fired.end(), deadline) == fired.end());
+        wheel.advance(deadline, [&](const TimerWheel::Timer& timer) { fired.push_back(timer.deadline); });
+        CPPUNIT_ASSERT_EQUAL(deadline, fired.back());
+    }
+    CPPUNIT_ASSERT_EQUAL((std::size_t)5, fired.size());
+}
+
+void TimerWheelTest::testScheduleFromCallback() {
+    TimerWheel wheel;
+    wheel.schedule(5, 0, 0);
+
+    // A periodic timer reschedules itself every 5 time units
+    std::vector<uint64_t> fired;
+    std::function<void(const TimerWheel::Timer&)> periodic = [&](const TimerWheel::Timer& timer) {
+        fired.push_back(timer.deadline);
+        wheel.schedule(timer.deadline + 5, 0, 0);
+    };
+    wheel.advance(23, periodic);
+    CPPUNIT_ASSERT(fired == std::vector<uint64_t>({ 5, 10, 15, 20 }));
+    CPPUNIT_ASSERT_EQUAL((std::size_t)1, wheel.pending());
+}
+
+void TimerWheelTest::testRandomTimers() {
+    std::mt19937 rng(7);
+    TimerWheel wheel;
+    std::vector<std::pair<uint64_t, uint32_t>> expected;
+    for (uint32_t id = 0; id < 2000; id++) {
+        const uint64_t deadline = 1 + rng() % (id % 2 ? 300000 : 2000);
+        wheel.schedule(deadline, 0, id);
+        expected.emplace_back(deadline, id);
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const std::pair<uint64_t, uint32_t>& a, const std::pair<uint64_t, uint32_t>& b) { return a.first < b.first; });
+
+    std::vector<std::pair<uint64_t, uint32_t>> fired;
+    uint64_t time = 0;
+    while (wheel.pending() > 0) {
+        time += 1 + rng() % 700;
+        wheel.advance(time, [&](const TimerWheel::Timer& timer) {
+            CPPUNIT_ASSERT(timer.deadline <= time);
+            fired.emplace_back(timer.deadline, timer.id);
+        });
+    }
+    CPPUNIT_ASSERT(fired == expected);
+}
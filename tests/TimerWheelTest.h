@@ -0,0 +1,32 @@
+#ifndef TIMERWHEELTEST_H
+#define TIMERWHEELTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/TimerWheel.h"
+
+/**
+ * @brief Test class for the TimerWheel class.
+ * 
+ * Tests the timer wheel including:
+ * - Firing timers at their deadline, in scheduling order for equal deadlines
+ * - Cascading far deadlines through the levels and the overflow list
+ * - Scheduling timers from the callback
+ * - Agreement with a sorted list of random timers
+ */
+class TimerWheelTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(TimerWheelTest);
+    CPPUNIT_TEST(testFireAtDeadline);
+    CPPUNIT_TEST(testFarDeadlines);
+    CPPUNIT_TEST(testScheduleFromCallback);
+    CPPUNIT_TEST(testRandomTimers);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testFireAtDeadline();
+    void testFarDeadlines();
+    void testScheduleFromCallback();
+    void testRandomTimers();
+};
+
+#endif // TIMERWHEELTEST_H
@@ -0,0 +1,80 @@
+#include "TraceTest.h"
+#include <cppunit/extensions/HelperMacros.h>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Register the test suite
+CPPUNIT_TEST_SUITE_REGISTRATION(TraceTest);
+
+static std::string readFile(const std::string& filename) {
+    std::ifstream in(filename);
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+void TraceTest::testSaveTraceEvents() {
+    Tracer tracer;
+    uint64_t start = Tracer::nowNs();
+    tracer.record("outer", start, start + 5000);
+    tracer.record("inner", start + 1000, start + 2000);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)2, tracer.spanCount());
+
+    CPPUNIT_ASSERT(tracer.save("trace_test.json"));
+    std::string json = readFile("trace_test.json");
+
+    CPPUNIT_ASSERT(json.find("{\"traceEvents\":[") == 0);
+    CPPUNIT_ASSERT(json.find("\"name\":\"outer\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"name\":\"inner\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"ph\":\"X\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"dur\":5.000") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"dur\":1.000") != std::string::npos);
+}
+
+void TraceTest::testThreadIds() {
+    Tracer tracer;
+    uint64_t start = Tracer::nowNs();
+    tracer.record("main", start, start + 1000);
+
+    std::thread worker([&tracer]() {
+        uint64_t workerStart = Tracer::nowNs();
+        tracer.record("worker", workerStart, workerStart + 1000);
+    });
+    worker.join();
+
+    CPPUNIT_ASSERT(tracer.save("trace_test_threads.json"));
+    std::string json = readFile("trace_test_threads.json");
+
+    std::size_t mainSpan = json.find("\"name\":\"main\"");
+    std::size_t workerSpan = json.find("\"name\":\"worker\"");
+    CPPUNIT_ASSERT(mainSpan != std::string::npos && workerSpan != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"tid\":1}", mainSpan) < workerSpan);
+    CPPUNIT_ASSERT(json.find("\"tid\":2}", workerSpan) != std::string::npos);
+}
+
+void TraceTest::testAlternatingTracers() {
+    // More tracers than a thread caches, so some lookups fall back to the tracer's buffers
+    const int numTracers = 6;
+    std::vector<std::unique_ptr<Tracer>> tracers;
+    for (int i = 0; i < numTracers; i++) {
+        tracers.emplace_back(new Tracer());
+    }
+    uint64_t start = Tracer::nowNs();
+    for (int round = 0; round < 3; round++) {
+        for (auto& tracer : tracers) {
+            tracer->record("alternating", start, start + 1000);
+        }
+    }
+
+    for (auto& tracer : tracers) {
+        CPPUNIT_ASSERT_EQUAL((std::size_t)3, tracer->spanCount());
+    }
+    CPPUNIT_ASSERT(tracers[0]->save("trace_test_alternating.json"));
+    std::string json = readFile("trace_test_alternating.json");
+    CPPUNIT_ASSERT(json.find("\"tid\":1}") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("\"tid\":2}") == std::string::npos);
+}
@@ -0,0 +1,29 @@
+#ifndef TRACETEST_H
+#define TRACETEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "../include/Trace.h"
+
+/**
+ * @brief Test class for the Tracer class.
+ * 
+ * Tests tracing functionality including:
+ * - Writing complete events in the Trace Event Format
+ * - Separate thread ids for spans recorded by different threads
+ * - One buffer per thread when a thread alternates between tracers
+ */
+class TraceTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(TraceTest);
+    CPPUNIT_TEST(testSaveTraceEvents);
+    CPPUNIT_TEST(testThreadIds);
+    CPPUNIT_TEST(testAlternatingTracers);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void testSaveTraceEvents();
+    void testThreadIds();
+    void testAlternatingTracers();
+};
+
+#endif // TRACETEST_H
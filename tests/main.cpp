@@ -10,6 +10,18 @@
 #include "CellTest.h"
 #include "PlayerTest.h"
 #include "LabyrinthTest.h"
+#include "LoggerTest.h"
+#include "EventLogTest.h"
+#include "TelemetryTest.h"
+#include "TraceTest.h"
+#include "PlayerPolicyTest.h"
+#include "GameBatchTest.h"
+#include "ObservationTest.h"
+#include "ItemPoolTest.h"
+#include "TimerWheelTest.h"
+#include "MinotaurHerdTest.h"
+#include "SimClockTest.h"
+#include "ReplayTest.h"
 
 int main() {
     // Create the event manager and test controller
@@ -0,0 +1,427 @@
+//
+// Description: labyrinth-bench measures the hot paths of the game (labyrinth
+// generation, path search, rendering, saving, spawning and bot decisions) over a sweep of
+// labyrinth sizes and prints the results as JSON.
+//
+// Usage: labyrinth-bench [--max-size N] [--iterations N] [--items N] [--output <file>]
+//
+// Every case reports the median and 99th percentile time of one operation,
+// the number of cells processed per second (based on the median) and the
+// number of heap allocations and bytes per operation. Sizes go from 15x15 up
+// to --max-size (default 1024, use 8192 for the full 8k x 8k sweep).
+//
+
+#include "Game.h"
+#include "GameBatch.h"
+#include "Labyrinth.h"
+#include "bots/ItemGreedyPolicy.h"
+#include "bots/MinotaurAvoidingPolicy.h"
+#include "bots/ShortestPathPolicy.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Allocation counting: every global new of the process goes through here
+//------------------------------------------------------------------------------
+static std::atomic<uint64_t> allocationCount{0};
+static std::atomic<uint64_t> allocatedBytes{0};
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+/**
+ * @brief Grants the benchmark access to the private phases it measures.
+ */
+class BenchAccess {
+    public:
+        static bool isPathExists(Labyrinth& labyrinth)
+        {
+            Cell start = labyrinth.getStartPoint();
+            Cell end = labyrinth.getEndPoint();
+            return labyrinth.isPathExists(start.getRow(), start.getCol(), end.getRow(), end.getCol());
+        }
+
+        static std::size_t findPath(Labyrinth& labyrinth)
+        {
+            return labyrinth.findPathFromEntranceToExit().size();
+        }
+
+        // Removes everything spawn() placed so it can run again on the same map
+        static void resetSpawn(Game& game)
+        {
+            game.items.clear();
+            game.brokenWalls.clear();
+        }
+
+        static void spawn(Game& game) { game.spawn(); }
+};
+
+/**
+ * @brief Stream buffer that discards everything, used as the sink of the print benchmarks.
+ */
+class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+/**
+ * @brief Summary of one benchmark case.
+ */
+struct BenchResult {
+    std::string name;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    std::size_t samples = 0;
+    uint64_t medianNs = 0;
+    uint64_t p99Ns = 0;
+    double cellsPerSecond = 0;
+    double allocations = 0;     ///< Heap allocations per operation.
+    double allocatedBytes = 0;  ///< Bytes allocated per operation.
+    double successRate = 1;     ///< Share of successful generations (construct cases only).
+    bool hasGenerationStats = false;
+    GenerationStats generation; ///< Median phase timings of the sampled generations (construct cases only).
+};
+
+struct BenchOptions {
+    unsigned int maxSize = 1024;
+    unsigned int iterations = 15;
+    unsigned int items = 10;
+    std::string output;
+};
+
+// Combines the statistics of several generations: medians for the timings and
+// counters, maximum for the scratch memory
+static GenerationStats summarize(std::vector<GenerationStats> samples)
+{
+    GenerationStats summary;
+    if (samples.empty()) {
+        return summary;
+    }
+
+    auto median = [&samples](auto field) {
+        std::vector<uint64_t> values;
+        for (const GenerationStats& stats : samples) {
+            values.push_back(stats.*field);
+        }
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    };
+
+    summary.resetNs = median(&GenerationStats::resetNs);
+    summary.ellerNs = median(&GenerationStats::ellerNs);
+    summary.semicircleNs = median(&GenerationStats::semicircleNs);
+    summary.pathCheckNs = median(&GenerationStats::pathCheckNs);
+    summary.wallConditionNs = median(&GenerationStats::wallConditionNs);
+    summary.findPathNs = median(&GenerationStats::findPathNs);
+    summary.totalNs = median(&GenerationStats::totalNs);
+    summary.attempts = static_cast<unsigned int>(median(&GenerationStats::attempts));
+    summary.noPathFailures = static_cast<unsigned int>(median(&GenerationStats::noPathFailures));
+    summary.wallConditionFailures = static_cast<unsigned int>(median(&GenerationStats::wallConditionFailures));
+    summary.bfsCellsVisited = median(&GenerationStats::bfsCellsVisited);
+    for (const GenerationStats& stats : samples) {
+        summary.peakScratchBytes = std::max(summary.peakScratchBytes, stats.peakScratchBytes);
+    }
+    return summary;
+}
+
+// Runs `setup` (untimed) and `operation` (timed) up to `iterations` times,
+// stopping early once the case has used its time budget
+template <typename Setup, typename Operation>
+static BenchResult measure(const std::string& name, unsigned int width, unsigned int height,
+                           unsigned int iterations, Setup setup, Operation operation)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto budget = std::chrono::seconds(5);
+    const unsigned int minSamples = 3;
+
+    std::vector<uint64_t> times;
+    times.reserve(iterations);
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    const auto caseStart = Clock::now();
+
+    for (unsigned int i = 0; i < iterations; i++) {
+        setup();
+
+        const uint64_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+        const uint64_t bytesBefore = allocatedBytes.load(std::memory_order_relaxed);
+        const auto start = Clock::now();
+        operation();
+        const auto end = Clock::now();
+        allocations += allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+        bytes += allocatedBytes.load(std::memory_order_relaxed) - bytesBefore;
+
+        times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        if (times.size() >= minSamples && end - caseStart > budget) {
+            break;
+        }
+    }
+
+    std::sort(times.begin(), times.end());
+    BenchResult result;
+    result.name = name;
+    result.width = width;
+    result.height = height;
+    result.samples = times.size();
+    result.medianNs = times[times.size() / 2];
+    // Nearest-rank percentile
+    result.p99Ns = times[std::min(times.size() - 1, (times.size() * 99 + 99) / 100 - 1)];
+    result.cellsPerSecond = result.medianNs > 0
+        ? static_cast<double>(width) * height * 1e9 / result.medianNs
+        : 0;
+    result.allocations = static_cast<double>(allocations) / times.size();
+    result.allocatedBytes = static_cast<double>(bytes) / times.size();
+    return result;
+}
+
+static void writeJson(std::ostream& out, const BenchOptions& options, const std::vector<BenchResult>& results)
+{
+    out << "{\n";
+    out << "  \"benchmark\": \"labyrinth-bench\",\n";
+    out << "  \"version\": 1,\n";
+    out << "  \"max_size\": " << options.maxSize << ",\n";
+    out << "  \"iterations\": " << options.iterations << ",\n";
+    out << "  \"items\": " << options.items << ",\n";
+    out << "  \"results\": [";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        char line[768];
+        std::snprintf(line, sizeof(line),
+                      "%s\n    {\"name\": \"%s\", \"width\": %u, \"height\": %u, \"samples\": %zu, "
+                      "\"median_ns\": %llu, \"p99_ns\": %llu, \"cells_per_sec\": %.0f, "
+                      "\"allocations\": %.1f, \"allocated_bytes\": %.0f, \"success_rate\": %.2f",
+                      i == 0 ? "" : ",", r.name.c_str(), r.width, r.height, r.samples,
+                      static_cast<unsigned long long>(r.medianNs), static_cast<unsigned long long>(r.p99Ns),
+                      r.cellsPerSecond, r.allocations, r.allocatedBytes, r.successRate);
+        out << line;
+
+        if (r.hasGenerationStats) {
+            const GenerationStats& g = r.generation;
+            std::snprintf(line, sizeof(line),
+                          ", \"generation\": {\"reset_ns\": %llu, \"eller_ns\": %llu, \"semicircle_ns\": %llu, "
+                          "\"path_check_ns\": %llu, \"wall_condition_ns\": %llu, \"find_path_ns\": %llu, "
+                          "\"total_ns\": %llu, \"attempts\": %u, \"no_path_failures\": %u, "
+                          "\"wall_condition_failures\": %u, \"bfs_cells_visited\": %llu, \"peak_scratch_bytes\": %zu}",
+                          static_cast<unsigned long long>(g.resetNs), static_cast<unsigned long long>(g.ellerNs),
+                          static_cast<unsigned long long>(g.semicircleNs), static_cast<unsigned long long>(g.pathCheckNs),
+                          static_cast<unsigned long long>(g.wallConditionNs), static_cast<unsigned long long>(g.findPathNs),
+                          static_cast<unsigned long long>(g.totalNs), g.attempts, g.noPathFailures,
+                          g.wallConditionFailures, static_cast<unsigned long long>(g.bfsCellsVisited),
+                          g.peakScratchBytes);
+            out << line;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+static bool parseArguments(int argc, char** argv, BenchOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            return false;
+        }
+        std::string value = argv[++i];
+        if (arg == "--max-size") {
+            options.maxSize = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--iterations") {
+            options.iterations = std::max(1u, static_cast<unsigned int>(std::stoul(value)));
+        } else if (arg == "--items") {
+            options.items = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--output") {
+            options.output = value;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    try {
+        if (!parseArguments(argc, argv, options)) {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--max-size N] [--iterations N] [--items N] [--output <file>]\n";
+            return 1;
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Invalid numeric argument.\n";
+        return 1;
+    }
+
+    const unsigned int sweep[] = { 15, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
+    const std::string saveFile = "labyrinth-bench.tmp";
+    const unsigned int iterations = options.iterations;
+
+    NullBuffer nullBuffer;
+    std::streambuf* consoleBuffer = std::cout.rdbuf();
+    std::vector<BenchResult> results;
+
+    for (unsigned int size : sweep) {
+        if (size > options.maxSize) {
+            break;
+        }
+        std::cerr << "Benchmarking " << size << " x " << size << "...\n";
+
+        // Keep the last successfully generated labyrinth for the remaining cases
+        std::unique_ptr<Labyrinth> built;
+        std::unique_ptr<Labyrinth> candidate;
+        unsigned int generated = 0;
+        std::vector<GenerationStats> generationSamples;
+        auto keepGenerated = [&] {
+            if (candidate) {
+                generationSamples.push_back(candidate->getGenerationStats());
+            }
+            if (candidate && candidate->getMapGenerationSuccess()) {
+                built = std::move(candidate);
+                generated++;
+            }
+            candidate.reset();
+        };
+        BenchResult construct = measure("construct", size, size, iterations,
+            keepGenerated,
+            [&] { candidate.reset(new Labyrinth(size, size, true)); });
+        keepGenerated();
+        construct.successRate = static_cast<double>(generated) / construct.samples;
+        construct.hasGenerationStats = true;
+        construct.generation = summarize(generationSamples);
+        results.push_back(construct);
+
+        if (!built) {
+            std::cerr << "  generation failed, skipping the remaining cases of this size\n";
+            continue;
+        }
+        Labyrinth& labyrinth = *built;
+
+        results.push_back(measure("isPathExists", size, size, iterations,
+            [] {},
+            [&] { BenchAccess::isPathExists(labyrinth); }));
+
+        results.push_back(measure("findPathFromEntranceToExit", size, size, iterations,
+            [] {},
+            [&] { BenchAccess::findPath(labyrinth); }));
+
+        std::cout.rdbuf(&nullBuffer);
+        results.push_back(measure("print", size, size, iterations,
+            [] {},
+            [&] { labyrinth.print(); }));
+
+        Cell center(size / 2, size / 2, ' ');
+        results.push_back(measure("printWithFogOfWar", size, size, iterations,
+            [] {},
+            [&] { labyrinth.printWithFogOfWar(center); }));
+        std::cout.rdbuf(consoleBuffer);
+
+        results.push_back(measure("saveToFile", size, size, iterations,
+            [] {},
+            [&] { labyrinth.saveToFile(saveFile); }));
+
+        results.push_back(measure("saveToBinaryFile", size, size, iterations,
+            [] {},
+            [&] { labyrinth.saveToBinaryFile(saveFile); }));
+
+        // spawn() needs room for the minotaur on the path, which tiny mazes may not have
+        if (labyrinth.getPathFromEntranceToExit().size() >= 14) {
+            {
+                // One operation is one tick of 1024 games sharing the labyrinth
+                std::shared_ptr<const Labyrinth> shared(std::move(built));
+
+                // One more session on the shared map: the allocated bytes are its whole footprint
+                GameConfig sessionConfig;
+                sessionConfig.numItems = options.items;
+                sessionConfig.seed = 1u;
+                results.push_back(measure("Game(shared labyrinth)", size, size, iterations,
+                    [] {},
+                    [&] { Game session(shared, sessionConfig); }));
+
+                GameBatch batch(shared, 1024, 1u, options.items);
+                std::vector<PlayerAction> actions(batch.size());
+                unsigned int round = 0;
+                if (batch.isReady()) {
+                    results.push_back(measure("GameBatch::step", size, size, iterations,
+                        [&] {
+                            round++;
+                            for (std::size_t i = 0; i < actions.size(); i++) {
+                                actions[i] = static_cast<PlayerAction>(1 + (i * 7 + round) % 5);
+                            }
+                            if (batch.countFinished() == batch.size()) {
+                                batch.reset(round);
+                            }
+                        },
+                        [&] { batch.step(actions.data()); }));
+
+                    // 11x11 windows (radius 5) of every game of the batch
+                    std::vector<uint8_t> windows(batch.size() * observationSize(5));
+                    results.push_back(measure("GameBatch::observe", size, size, iterations,
+                        [] {},
+                        [&] { batch.observe(5, windows.data()); }));
+                }
+            }
+            built.reset(); // Free the grid before the game allocates its own
+            Game game(size, size, options.items, false, true, false);
+            if (game.isLabyrinthGenerated()) {
+                results.push_back(measure("Game::spawn", size, size, iterations,
+                    [&] { BenchAccess::resetSpawn(game); },
+                    [&] { BenchAccess::spawn(game); }));
+
+                // One decision per operation; the first call (field computation) is left out
+                // so the allocation columns show the steady state, which must be zero
+                ShortestPathPolicy shortestPath;
+                ItemGreedyPolicy itemGreedy;
+                MinotaurAvoidingPolicy minotaurAvoiding;
+                for (PlayerPolicy* policy : { static_cast<PlayerPolicy*>(&shortestPath),
+                                              static_cast<PlayerPolicy*>(&itemGreedy),
+                                              static_cast<PlayerPolicy*>(&minotaurAvoiding) }) {
+                    policy->reset(0);
+                    policy->nextAction(game.getView());
+                    results.push_back(measure(std::string("policy:") + policy->getName(), size, size, iterations,
+                        [] {},
+                        [&] { policy->nextAction(game.getView()); }));
+                }
+            }
+        }
+    }
+    std::remove(saveFile.c_str());
+
+    if (options.output.empty()) {
+        writeJson(std::cout, options, results);
+    } else {
+        std::ofstream out(options.output);
+        if (!out) {
+            std::cerr << "Unable to open " << options.output << "\n";
+            return 1;
+        }
+        writeJson(out, options, results);
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+//
+// Description: labyrinth-logdump turns a binary event log written by the game
+// (game.events) back into readable text or CSV.
+//
+// Usage: labyrinth-logdump [--csv] <file>
+//
+
+#include "EventLog.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Names of ItemKind values, indexed by the raw kind stored in the record
+static const char* itemKindName(uint8_t kind)
+{
+    static const char* const NAMES[] = { "FogOfWar", "Hummer", "Shield", "Sword" };
+    return kind < 4 ? NAMES[kind] : "Unknown";
+}
+
+// Names of the Game states stored in STATE_CHANGED records
+static const char* stateName(uint8_t state)
+{
+    static const char* const NAMES[] = { "PLAYING", "PLAYER_WON", "PLAYER_LOST", "QUIT" };
+    return state < 4 ? NAMES[state] : "UNKNOWN";
+}
+
+// Human-readable description of the type-specific argument
+static std::string describeArg(const GameEvent& event)
+{
+    switch (static_cast<GameEventType>(event.type)) {
+        case GameEventType::ITEM_SPAWNED:
+        case GameEventType::ITEM_ACTIVATED:
+        case GameEventType::ITEM_EXPIRED:
+        case GameEventType::ITEM_DESTROYED:
+            return itemKindName(event.arg);
+        case GameEventType::PLAYER_MOVED:
+            return std::string(1, static_cast<char>(event.arg));
+        case GameEventType::STATE_CHANGED:
+            return stateName(event.arg);
+        default:
+            return "";
+    }
+}
+
+static void printText(const GameEvent& event)
+{
+    std::cout << "[tick " << event.tick << "] " << EventLog::typeName(event.type)
+              << " at " << event.row << " " << event.col;
+    if (event.itemId != GameEvent::NO_ITEM) {
+        std::cout << " item " << event.itemId;
+    }
+    std::string arg = describeArg(event);
+    if (!arg.empty()) {
+        std::cout << " (" << arg << ")";
+    }
+    std::cout << "\n";
+}
+
+static void printCsv(const GameEvent& event)
+{
+    std::cout << event.tick << ',' << EventLog::typeName(event.type) << ','
+              << event.row << ',' << event.col << ',';
+    if (event.itemId != GameEvent::NO_ITEM) {
+        std::cout << event.itemId;
+    }
+    std::cout << ',' << describeArg(event) << "\n";
+}
+
+int main(int argc, char** argv)
+{
+    bool csv = false;
+    const char* filename = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else {
+            filename = argv[i];
+        }
+    }
+
+    if (!filename) {
+        std::cerr << "Usage: " << argv[0] << " [--csv] <file>\n";
+        return 1;
+    }
+
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    if (!in) {
+        std::cerr << "Error: Unable to open " << filename << "\n";
+        return 1;
+    }
+    if (!EventLog::readHeader(in)) {
+        std::cerr << "Error: " << filename << " is not a supported event log\n";
+        return 1;
+    }
+
+    if (csv) {
+        std::cout << "tick,event,row,col,item,arg\n";
+    }
+
+    // Stream the records in chunks so arbitrarily long logs need constant memory
+    std::vector<GameEvent> chunk(4096);
+    while (in) {
+        in.read(reinterpret_cast<char*>(chunk.data()),
+                static_cast<std::streamsize>(chunk.size() * sizeof(GameEvent)));
+        std::size_t count = static_cast<std::size_t>(in.gcount()) / sizeof(GameEvent);
+        for (std::size_t i = 0; i < count; i++) {
+            if (csv) {
+                printCsv(chunk[i]);
+            } else {
+                printText(chunk[i]);
+            }
+        }
+    }
+
+    return 0;
+}
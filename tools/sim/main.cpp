@@ -0,0 +1,291 @@
+//
+// Description: labyrinth-sim plays many headless games with an automated
+// player on a pool of worker threads and prints aggregate statistics.
+//
+// Usage: labyrinth-sim [--games N] [--threads N] [--width N] [--height N]
+//                      [--items N] [--seed N] [--bot NAME] [--max-ticks N]
+//                      [--map-seed N] [--minotaurs N] [--chase 0|1]
+//
+// Bots: random, shortest-path, item-greedy, minotaur-avoiding.
+//
+// Every game gets its own seed derived from --seed and the game index, so a run
+// is reproducible regardless of the number of threads. Games that have not ended
+// after --max-ticks ticks are counted as quit. Labyrinths that cannot be used
+// (generation failure, path too short for the minotaur) are reported separately.
+//
+// With --map-seed every game plays on the same labyrinth, generated once from that
+// seed and shared read-only by all workers; the game seeds then only vary the spawn
+// positions and the minotaur.
+//
+
+#include "Game.h"
+#include "bots/PlayerPolicy.h"
+#include "bots/RandomPolicy.h"
+#include "bots/ShortestPathPolicy.h"
+#include "bots/ItemGreedyPolicy.h"
+#include "bots/MinotaurAvoidingPolicy.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Command line options of the simulation.
+ */
+struct SimOptions {
+    unsigned int games = 1000;
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int width = 21;
+    unsigned int height = 21;
+    unsigned int items = 4;
+    unsigned int seed = 1;
+    unsigned int maxTicks = 10000;
+    unsigned int mapSeed = 0;           ///< Seed of the labyrinth shared by all games; 0 generates one per game.
+    unsigned int minotaurs = 1;         ///< Minotaurs per game.
+    bool chase = false;                 ///< Minotaurs chase the player instead of moving randomly.
+    std::string bot = "random";
+};
+
+/**
+ * @brief Outcomes collected by one worker, merged after all games finished.
+ */
+struct SimTotals {
+    uint64_t failedSetups = 0;
+    uint64_t won = 0;
+    uint64_t lost = 0;
+    uint64_t quit = 0;
+    uint64_t ticks = 0;
+    uint64_t minotaurKills = 0;
+    uint64_t itemsDestroyed = 0;
+    uint64_t pickups[4] = {0, 0, 0, 0};
+    std::vector<uint32_t> turnsToFinish;    ///< Player moves of every won or lost game.
+
+    void merge(const SimTotals& other)
+    {
+        failedSetups += other.failedSetups;
+        won += other.won;
+        lost += other.lost;
+        quit += other.quit;
+        ticks += other.ticks;
+        minotaurKills += other.minotaurKills;
+        itemsDestroyed += other.itemsDestroyed;
+        for (int i = 0; i < 4; i++) {
+            pickups[i] += other.pickups[i];
+        }
+        turnsToFinish.insert(turnsToFinish.end(), other.turnsToFinish.begin(), other.turnsToFinish.end());
+    }
+};
+
+// SplitMix64 finalizer: neighbouring game indices get unrelated seeds
+static unsigned int gameSeed(unsigned int base, unsigned int index)
+{
+    uint64_t z = (static_cast<uint64_t>(base) << 32) + index + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    unsigned int seed = static_cast<unsigned int>(z);
+    return seed ? seed : 1;     // 0 asks the game for a random seed
+}
+
+static std::unique_ptr<PlayerPolicy> makePolicy(const std::string& name)
+{
+    if (name == "random") {
+        return std::unique_ptr<PlayerPolicy>(new RandomPolicy());
+    }
+    if (name == "shortest-path") {
+        return std::unique_ptr<PlayerPolicy>(new ShortestPathPolicy());
+    }
+    if (name == "item-greedy") {
+        return std::unique_ptr<PlayerPolicy>(new ItemGreedyPolicy());
+    }
+    if (name == "minotaur-avoiding") {
+        return std::unique_ptr<PlayerPolicy>(new MinotaurAvoidingPolicy());
+    }
+    return nullptr;
+}
+
+static void playGame(const SimOptions& options, unsigned int index, const std::shared_ptr<const Labyrinth>& sharedMap,
+                     PlayerPolicy& policy, SimTotals& totals)
+{
+    GameConfig config;
+    config.width = options.width;
+    config.height = options.height;
+    config.numItems = options.items;
+    config.seed = gameSeed(options.seed, index);
+    config.minotaurCount = options.minotaurs;
+    config.chasingMinotaurs = options.chase;
+
+    std::unique_ptr<Game> game(sharedMap ? new Game(sharedMap, config) : new Game(config));
+    if (!game->isReady()) {
+        totals.failedSetups++;
+        return;
+    }
+
+    policy.reset(config.seed);
+    while (!game->isFinished() && game->getTick() < options.maxTicks) {
+        game->step(policy.nextAction(game->getView()));
+    }
+
+    const GameStats& stats = game->getStats();
+    switch (game->getState()) {
+        case Game::PLAYER_WON:
+            totals.won++;
+            totals.turnsToFinish.push_back(stats.turns);
+            break;
+        case Game::PLAYER_LOST:
+            totals.lost++;
+            totals.turnsToFinish.push_back(stats.turns);
+            break;
+        default:
+            totals.quit++;  // Quit by the policy or out of ticks
+            break;
+    }
+    totals.ticks += stats.ticks;
+    totals.minotaurKills += stats.minotaurKills;
+    totals.itemsDestroyed += stats.itemsDestroyed;
+    for (int i = 0; i < 4; i++) {
+        totals.pickups[i] += stats.pickups[i];
+    }
+}
+
+static void printReport(const SimOptions& options, SimTotals& totals, double seconds)
+{
+    const uint64_t played = totals.won + totals.lost + totals.quit;
+    auto rate = [played](uint64_t count) { return played ? 100.0 * count / played : 0.0; };
+    auto perGame = [played](uint64_t count) { return played ? static_cast<double>(count) / played : 0.0; };
+
+    double meanTurns = 0.0;
+    uint32_t medianTurns = 0;
+    if (!totals.turnsToFinish.empty()) {
+        uint64_t sum = 0;
+        for (uint32_t turns : totals.turnsToFinish) {
+            sum += turns;
+        }
+        meanTurns = static_cast<double>(sum) / totals.turnsToFinish.size();
+        auto middle = totals.turnsToFinish.begin() + totals.turnsToFinish.size() / 2;
+        std::nth_element(totals.turnsToFinish.begin(), middle, totals.turnsToFinish.end());
+        medianTurns = *middle;
+    }
+
+    std::printf("bot %s, %u games of %ux%u with %u items, %u threads, base seed %u\n",
+                options.bot.c_str(), options.games, options.width, options.height,
+                options.items, options.threads, options.seed);
+    if (options.mapSeed != 0) {
+        std::printf("shared labyrinth, map seed %u\n", options.mapSeed);
+    }
+    std::printf("failed setups:   %llu\n", static_cast<unsigned long long>(totals.failedSetups));
+    std::printf("won:             %llu (%.1f%%)\n", static_cast<unsigned long long>(totals.won), rate(totals.won));
+    std::printf("lost:            %llu (%.1f%%)\n", static_cast<unsigned long long>(totals.lost), rate(totals.lost));
+    std::printf("quit:            %llu (%.1f%%)\n", static_cast<unsigned long long>(totals.quit), rate(totals.quit));
+    std::printf("turns to finish: mean %.1f, median %u\n", meanTurns, medianTurns);
+    std::printf("ticks per game:  %.1f\n", perGame(totals.ticks));
+    std::printf("minotaur kills:  %.3f per game\n", perGame(totals.minotaurKills));
+    std::printf("items destroyed: %.3f per game\n", perGame(totals.itemsDestroyed));
+    std::printf("pickups per game: fog of war %.3f, hummer %.3f, shield %.3f, sword %.3f\n",
+                perGame(totals.pickups[static_cast<int>(ItemKind::FOG_OF_WAR)]),
+                perGame(totals.pickups[static_cast<int>(ItemKind::HUMMER)]),
+                perGame(totals.pickups[static_cast<int>(ItemKind::SHIELD)]),
+                perGame(totals.pickups[static_cast<int>(ItemKind::SWORD)]));
+    std::printf("throughput:      %.1f games/s (%.2f s)\n", seconds > 0 ? options.games / seconds : 0.0, seconds);
+}
+
+static bool parseArguments(int argc, char** argv, SimOptions& options)
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            return false;
+        }
+        std::string value = argv[++i];
+        if (arg == "--games") {
+            options.games = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--threads") {
+            options.threads = std::max(1u, static_cast<unsigned int>(std::stoul(value)));
+        } else if (arg == "--width") {
+            options.width = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--height") {
+            options.height = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--items") {
+            options.items = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--seed") {
+            options.seed = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--max-ticks") {
+            options.maxTicks = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--map-seed") {
+            options.mapSeed = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--minotaurs") {
+            options.minotaurs = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--chase") {
+            options.chase = std::stoul(value) != 0;
+        } else if (arg == "--bot") {
+            options.bot = value;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    SimOptions options;
+    try {
+        if (!parseArguments(argc, argv, options)) {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--games N] [--threads N] [--width N] [--height N] [--items N]"
+                         " [--seed N] [--bot NAME] [--max-ticks N] [--map-seed N]"
+                         " [--minotaurs N] [--chase 0|1]\n";
+            return 1;
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Invalid numeric argument.\n";
+        return 1;
+    }
+    if (!makePolicy(options.bot)) {
+        std::cerr << "Unknown bot: " << options.bot << "\n";
+        return 1;
+    }
+
+    // All workers read the same labyrinth; games never write to it
+    std::shared_ptr<const Labyrinth> sharedMap;
+    if (options.mapSeed != 0) {
+        sharedMap = std::make_shared<const Labyrinth>(options.width, options.height, true, options.mapSeed);
+    }
+
+    // A fixed set of workers pulls game indices from a shared counter, so slow games
+    // (large mazes, long walks) never leave other threads idle
+    const unsigned int workerCount = std::min(options.threads, std::max(1u, options.games));
+    std::atomic<unsigned int> nextGame{0};
+    std::vector<SimTotals> workerTotals(workerCount);
+    std::vector<std::thread> workers;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int w = 0; w < workerCount; w++) {
+        workers.emplace_back([&, w] {
+            std::unique_ptr<PlayerPolicy> policy = makePolicy(options.bot);
+            for (;;) {
+                unsigned int index = nextGame.fetch_add(1, std::memory_order_relaxed);
+                if (index >= options.games) {
+                    break;
+                }
+                playGame(options, index, sharedMap, *policy, workerTotals[w]);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    SimTotals totals;
+    for (const SimTotals& worker : workerTotals) {
+        totals.merge(worker);
+    }
+    printReport(options, totals, seconds);
+    return 0;
+}